@@ -1,8 +1,23 @@
+#include "src/AZ/MCTS.hpp"
 #include "src/Core/Game.hpp"
+#include "src/Engine/Nnue.hpp"
+#include "src/Engine/ParallelSearch.hpp"
+#include "src/Engine/Perft.hpp"
+#include "src/Engine/StaticExchange.hpp"
+#include "src/Engine/TranspositionTable.hpp"
+#include "src/IO/FenLoader.hpp"
+#include "src/IO/PgnReplayer.hpp"
+#include "src/UI/UciProtocol.hpp"
 #include "src/Utils/Position.hpp"
 #include "src/Utils/Move.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <random>
+#include <sstream>
 #include <string>
+#include <vector>
 
 /**
  * Fonction pour parser une position depuis une notation d'échecs (ex: "e2")
@@ -25,24 +40,679 @@ Position parsePosition(const std::string& notation) {
     return Position(x, y);
 }
 
+/**
+ * Retourne le message de fin de partie
+ */
+std::string describeGameEnd(const Game& game) {
+    switch (game.getGameState()) {
+        case GameState::CHECKMATE:
+            return std::string("Échec et mat ! Les ") +
+                   (game.getCurrentPlayer()->isWhite() ? "Noirs" : "Blancs") + " gagnent.";
+        case GameState::STALEMATE:
+            return "Pat : partie nulle.";
+        case GameState::DRAW:
+            return "Partie nulle (répétition ou règle des 50 coups).";
+        default:
+            return "";
+    }
+}
+
+/**
+ * Cherche le meilleur coup du joueur actuel (commande "go", sans le jouer)
+ * La table est créée au premier appel et conservée d'un coup à l'autre.
+ * @return EngineMove::none() si la partie est terminée
+ */
+EngineMove findBestMove(const Game& game, std::unique_ptr<TranspositionTable>& table, const SearchLimits& limits) {
+    if (game.isGameOver()) {
+        return EngineMove::none();
+    }
+    if (!table) {
+        table = std::make_unique<TranspositionTable>();
+    }
+    auto listener = [](const SearchReport& report) {
+        std::cout << "profondeur " << report.depth << ", score " << report.score
+                  << ", " << report.nodes << " nœuds" << std::endl;
+    };
+    std::atomic<bool> stop(false);
+    const Board& board = game.getBoard();
+    return ParallelSearch::run(board.getState(), board.getRepetitionKeys(), limits, stop, table.get(), nullptr, 0,
+                               listener);
+}
+
+/**
+ * Mode perft : chess perft <profondeur> [--divide] [--threads N] [--hash Mo] [--fen "<FEN>"]
+ */
+int runPerft(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: perft <profondeur> [--divide] [--threads N] [--hash Mo] [--fen \"<FEN>\"]" << std::endl;
+        return 1;
+    }
+    
+    int depth = std::stoi(args[0]);
+    bool divide = false;
+    size_t threads = ThreadPool::defaultThreadCount();
+    size_t hashMegabytes = 0;
+    BoardState position = BoardState::startingPosition();
+    
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--divide") {
+            divide = true;
+        } else if (args[i] == "--threads" && i + 1 < args.size()) {
+            threads = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--hash" && i + 1 < args.size()) {
+            hashMegabytes = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--fen" && i + 1 < args.size()) {
+            position = Fen::parse(args[++i]);
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    std::unique_ptr<PerftCache> cache;
+    if (hashMegabytes > 0) {
+        cache = std::make_unique<PerftCache>(hashMegabytes);
+    }
+    
+    PerftResult result = Perft::run(position, depth, threads, cache.get());
+    
+    if (divide) {
+        for (const PerftEntry& entry : result.divide) {
+            std::cout << entry.move.toString() << ": " << entry.nodes << std::endl;
+        }
+        std::cout << std::endl;
+    }
+    
+    std::cout << "Nœuds: " << result.nodes << std::endl;
+    std::cout << "Temps: " << result.seconds << " s" << std::endl;
+    std::cout << "Nœuds/s: " << static_cast<std::uint64_t>(result.nodesPerSecond()) << std::endl;
+    if (cache) {
+        std::cout << "Cache: " << (cache->sizeInBytes() / (1024 * 1024)) << " Mo, succès "
+                  << (100.0 * result.cacheHitRate()) << " % (" << result.cacheHits << "/"
+                  << result.cacheProbes << ")" << std::endl;
+    }
+    return 0;
+}
+
+/**
+ * Mode chargement : chess fenload <fichier> [--threads N]
+ * Charge un fichier FEN/EPD en mémoire et affiche le débit et les lignes rejetées
+ */
+int runFenLoad(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: fenload <fichier> [--threads N]" << std::endl;
+        return 1;
+    }
+    
+    size_t threads = ThreadPool::defaultThreadCount();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--threads" && i + 1 < args.size()) {
+            threads = static_cast<size_t>(std::stoul(args[++i]));
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    FenLoadResult result = FenLoader::load(args[0], threads);
+    
+    const size_t MAX_REPORTED_ERRORS = 10;
+    for (size_t i = 0; i < result.errors.size() && i < MAX_REPORTED_ERRORS; ++i) {
+        std::cout << "Ligne " << result.errors[i].line << ": " << result.errors[i].message << std::endl;
+    }
+    
+    std::cout << "Lignes: " << result.lines << std::endl;
+    std::cout << "Positions: " << result.positions.size() << " ("
+              << result.positions.size() * sizeof(PackedPosition) / 1024 << " Kio)" << std::endl;
+    std::cout << "Erreurs: " << result.errors.size() << std::endl;
+    std::cout << "Temps: " << result.seconds << " s" << std::endl;
+    std::cout << "Positions/s: " << static_cast<std::uint64_t>(result.positionsPerSecond()) << std::endl;
+    return 0;
+}
+
+/**
+ * Mode rejeu : chess pgn <fichier> [--threads N]
+ * Rejoue chaque partie avec les règles du moteur et liste les coups illégaux
+ */
+int runPgnReplay(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: pgn <fichier> [--threads N]" << std::endl;
+        return 1;
+    }
+    
+    size_t threads = ThreadPool::defaultThreadCount();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--threads" && i + 1 < args.size()) {
+            threads = static_cast<size_t>(std::stoul(args[++i]));
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    PgnReplayResult result = PgnReplayer::replayFile(args[0], threads);
+    
+    for (const PgnError& error : result.errors) {
+        std::cout << "Partie " << error.game << ", ligne " << error.line;
+        if (error.ply > 0) {
+            std::cout << ", demi-coup " << error.ply;
+        }
+        std::cout << " (" << error.move << "): " << error.message << std::endl;
+    }
+    
+    std::cout << "Parties: " << result.games << std::endl;
+    std::cout << "Demi-coups: " << result.plies << std::endl;
+    std::cout << "Erreurs: " << result.errors.size() << std::endl;
+    std::cout << "Temps: " << result.seconds << " s" << std::endl;
+    std::cout << "Parties/s: " << static_cast<std::uint64_t>(result.gamesPerSecond()) << std::endl;
+    std::cout << "Demi-coups/s: " << static_cast<std::uint64_t>(result.pliesPerSecond()) << std::endl;
+    return result.errors.empty() ? 0 : 2;
+}
+
+/**
+ * Mode SEE : chess see "<FEN>" <coup>...
+ * Affiche le bilan de l'échange (en centipions) provoqué par chaque coup, en SAN ou UCI
+ */
+int runSee(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        std::cerr << "Usage: see \"<FEN>\" <coup>..." << std::endl;
+        return 1;
+    }
+    
+    BoardState position = Fen::parse(args[0]);
+    for (size_t i = 1; i < args.size(); ++i) {
+        EngineMove move;
+        const char* error = Notation::readUci(position, args[i], move);
+        if (error) {
+            error = Notation::readSan(position, args[i], move);
+        }
+        if (error) {
+            std::cerr << error << " : " << args[i] << std::endl;
+            return 1;
+        }
+        std::cout << Notation::toSan(position, move) << "  SEE " << StaticExchange::evaluate(position, move)
+                  << std::endl;
+    }
+    return 0;
+}
+
+/**
+ * Mode NNUE : chess nnue <fichier> [--random] [--playouts N] [--fen "<FEN>"]
+ * --random écrit d'abord un réseau aléatoire dans le fichier (aucun réseau entraîné n'est fourni).
+ * Pour chaque jeu de noyaux : évaluation de la position, puis parties aléatoires jouées
+ * avec mise à jour incrémentale des accumulateurs, comparée à chaque coup (et au retour)
+ * à une reconstruction complète ; enfin le débit des mises à jour, des reconstructions
+ * et de la propagation dans les couches denses.
+ */
+int runNnue(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: nnue <fichier> [--random] [--playouts N] [--fen \"<FEN>\"]" << std::endl;
+        return 1;
+    }
+    
+    bool random = false;
+    int playouts = 200;
+    BoardState position = BoardState::startingPosition();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--random") {
+            random = true;
+        } else if (args[i] == "--playouts" && i + 1 < args.size()) {
+            playouts = std::stoi(args[++i]);
+        } else if (args[i] == "--fen" && i + 1 < args.size()) {
+            position = Fen::parse(args[++i]);
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    if (random) {
+        Nnue::NetworkFile::writeRandom(args[0]);
+    }
+    Nnue::NetworkFile file(args[0]);
+    const Nnue::Network& network = file.network();
+    
+    // Parties aléatoires, les mêmes pour tous les noyaux
+    constexpr int MAX_PLIES = 200;
+    std::mt19937 generator(1);
+    std::vector<std::vector<EngineMove>> games;
+    size_t positions = 0;
+    for (int game = 0; game < playouts; ++game) {
+        BoardState state = position;
+        UndoInfo undo;
+        std::vector<EngineMove> moves;
+        while (moves.size() < MAX_PLIES) {
+            MoveList legal;
+            MoveGenerator::generateLegalMoves(state, legal);
+            if (legal.empty()) {
+                break;
+            }
+            moves.push_back(legal[static_cast<int>(generator() % static_cast<unsigned>(legal.size()))]);
+            state.makeMove(moves.back(), undo);
+        }
+        positions += moves.size();
+        games.push_back(std::move(moves));
+    }
+    
+    auto perSecond = [positions](std::chrono::steady_clock::time_point start) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<std::uint64_t>(static_cast<double>(positions) / std::max(seconds, 1e-9));
+    };
+    
+    int reference = 0;
+    bool first = true;
+    for (const Nnue::Kernels* kernels : Nnue::availableKernels()) {
+        Nnue::AccumulatorStack incremental;
+        Nnue::AccumulatorStack fresh;
+        for (Nnue::AccumulatorStack* stack : {&incremental, &fresh}) {
+            stack->setNetwork(&network);
+            stack->setKernels(*kernels);
+        }
+        incremental.reset(position);
+        int score = incremental.evaluate(position);
+        if (first) {
+            reference = score;
+            first = false;
+        }
+        
+        // Chaque évaluation incrémentale, à l'aller puis au retour, doit égaler la reconstruction complète
+        std::uint64_t mismatches = 0;
+        for (const std::vector<EngineMove>& moves : games) {
+            BoardState state = position;
+            std::vector<UndoInfo> undo(moves.size());
+            std::vector<int> scores(moves.size());
+            incremental.reset(state);
+            for (size_t ply = 0; ply < moves.size(); ++ply) {
+                incremental.push(state, moves[ply]);
+                state.makeMove(moves[ply], undo[ply]);
+                scores[ply] = incremental.evaluate(state);
+                fresh.reset(state);
+                mismatches += fresh.evaluate(state) != scores[ply];
+            }
+            for (size_t ply = moves.size(); ply-- > 0;) {
+                mismatches += incremental.evaluate(state) != scores[ply];
+                state.unmakeMove(moves[ply], undo[ply]);
+                incremental.pop();
+            }
+        }
+        
+        // Débits : mises à jour le long des parties (makeMove compris), reconstructions, propagation seule
+        auto start = std::chrono::steady_clock::now();
+        for (const std::vector<EngineMove>& moves : games) {
+            BoardState state = position;
+            UndoInfo undo;
+            incremental.reset(state);
+            for (const EngineMove& move : moves) {
+                incremental.push(state, move);
+                state.makeMove(move, undo);
+            }
+        }
+        std::uint64_t updates = perSecond(start);
+        
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < positions; ++i) {
+            fresh.reset(position);
+        }
+        std::uint64_t refreshes = perSecond(start);
+        
+        start = std::chrono::steady_clock::now();
+        std::int64_t sum = 0;
+        for (size_t i = 0; i < positions; ++i) {
+            sum += fresh.evaluate(position);
+        }
+        std::uint64_t propagations = perSecond(start);
+        
+        std::cout << kernels->name << "  évaluation " << score
+                  << "  positions " << positions << "  écarts " << mismatches
+                  << "  mises à jour/s " << updates << "  reconstructions/s " << refreshes
+                  << "  propagations/s " << propagations << std::endl;
+        if (mismatches > 0 || score != reference || sum != static_cast<std::int64_t>(positions) * score) {
+            std::cerr << "Résultats différents selon les noyaux ou le mode de calcul" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Mode recherche : chess search <profondeur> [--movetime ms] [--threads N] [--hash Mo] [--nnue <fichier>] [--fen "<FEN>"]
+ * Affiche profondeur, score, nœuds, débit et variation principale à chaque itération
+ */
+int runSearch(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: search <profondeur> [--movetime ms] [--threads N] [--hash Mo] [--nnue <fichier>]"
+                  << " [--fen \"<FEN>\"]" << std::endl;
+        return 1;
+    }
+    
+    SearchLimits limits;
+    limits.depth = std::stoi(args[0]);
+    size_t threads = 1;
+    size_t hashMegabytes = 16;
+    std::unique_ptr<Nnue::NetworkFile> network;
+    BoardState position = BoardState::startingPosition();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--movetime" && i + 1 < args.size()) {
+            limits.moveTime = std::stoll(args[++i]);
+        } else if (args[i] == "--threads" && i + 1 < args.size()) {
+            threads = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--hash" && i + 1 < args.size()) {
+            hashMegabytes = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--nnue" && i + 1 < args.size()) {
+            network = std::make_unique<Nnue::NetworkFile>(args[++i]);
+        } else if (args[i] == "--fen" && i + 1 < args.size()) {
+            position = Fen::parse(args[++i]);
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    // --hash 0 : recherche sans table de transposition
+    std::unique_ptr<TranspositionTable> table;
+    if (hashMegabytes > 0) {
+        table = std::make_unique<TranspositionTable>(hashMegabytes);
+    }
+    std::unique_ptr<ThreadPool> helpers;
+    if (threads > 1) {
+        helpers = std::make_unique<ThreadPool>(threads - 1);
+    }
+    
+    std::atomic<bool> stop(false);
+    EngineMove best = ParallelSearch::run(position, {}, limits, stop, table.get(), helpers.get(), 0,
+                                          [](const SearchReport& report) {
+        std::cout << "Profondeur " << report.depth << "  score " << report.score
+                  << "  nœuds " << report.nodes << "  table " << report.hashfull << " ‰"
+                  << "  coupures 1er coup " << static_cast<int>(report.firstMoveCutoffRate() * 100.0 + 0.5) << " %"
+                  << "  pions " << static_cast<int>(report.pawnHitRate * 100.0 + 0.5) << " %"
+                  << "  nœuds/s " << static_cast<std::uint64_t>(report.nodesPerSecond())
+                  << "  temps " << static_cast<std::uint64_t>(report.seconds * 1000.0) << " ms  pv";
+        for (const EngineMove& move : report.pv) {
+            std::cout << " " << move.toString();
+        }
+        std::cout << std::endl;
+    }, network ? &network->network() : nullptr);
+    std::cout << "Meilleur coup: " << Notation::toUci(best) << std::endl;
+    return 0;
+}
+
+/**
+ * Mode mesure Lazy SMP : chess smp <profondeur> [--threads 1,2,4,...] [--hash Mo] [--fen "<FEN>"]
+ * Pour chaque nombre de threads, table vidée : temps pour atteindre la profondeur, nœuds et débit
+ */
+int runSmpBench(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: smp <profondeur> [--threads 1,2,4,...] [--hash Mo] [--fen \"<FEN>\"]" << std::endl;
+        return 1;
+    }
+    
+    SearchLimits limits;
+    limits.depth = std::stoi(args[0]);
+    std::vector<size_t> threadCounts = {1, 2, 4, 8, 16, 32};
+    size_t hashMegabytes = 256;
+    BoardState position = BoardState::startingPosition();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--threads" && i + 1 < args.size()) {
+            threadCounts.clear();
+            std::istringstream list(args[++i]);
+            std::string count;
+            while (std::getline(list, count, ',')) {
+                threadCounts.push_back(static_cast<size_t>(std::stoul(count)));
+            }
+        } else if (args[i] == "--hash" && i + 1 < args.size()) {
+            hashMegabytes = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--fen" && i + 1 < args.size()) {
+            position = Fen::parse(args[++i]);
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    TranspositionTable table(hashMegabytes);
+    double baseSeconds = 0.0;
+    double baseRate = 0.0;
+    for (size_t threads : threadCounts) {
+        table.clear(threads);
+        std::unique_ptr<ThreadPool> helpers;
+        if (threads > 1) {
+            helpers = std::make_unique<ThreadPool>(threads - 1);
+        }
+        
+        SearchReport last;
+        std::atomic<bool> stop(false);
+        ParallelSearch::run(position, {}, limits, stop, &table, helpers.get(), 0,
+                            [&last](const SearchReport& report) { last = report; });
+        
+        if (baseSeconds == 0.0) {
+            baseSeconds = last.seconds;
+            baseRate = last.nodesPerSecond();
+        }
+        std::cout << "Threads " << threads
+                  << "  temps " << static_cast<std::uint64_t>(last.seconds * 1000.0) << " ms"
+                  << " (x" << (last.seconds > 0.0 ? baseSeconds / last.seconds : 0.0) << ")"
+                  << "  nœuds " << last.nodes
+                  << "  nœuds/s " << static_cast<std::uint64_t>(last.nodesPerSecond())
+                  << " (x" << (baseRate > 0.0 ? last.nodesPerSecond() / baseRate : 0.0) << ")"
+                  << "  score " << last.score << "  coup " << (last.pv.empty() ? "-" : last.pv[0].toString())
+                  << std::endl;
+    }
+    return 0;
+}
+
+/**
+ * Mode MCTS : chess mcts <itérations> [--movetime ms] [--threads N] [--memory Mo] [--rollout N] [--ucb1] [--fen "<FEN>"]
+ * Affiche le débit, la taille de l'arbre, la suite principale et les coups les plus visités à la racine
+ */
+int runMcts(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: mcts <itérations> [--movetime ms] [--threads N] [--memory Mo] [--rollout N] [--ucb1]"
+                  << " [--fen \"<FEN>\"]" << std::endl;
+        return 1;
+    }
+    
+    SearchLimits limits;
+    limits.nodes = std::stoull(args[0]);
+    size_t threads = 1;
+    size_t memoryMegabytes = 256;
+    MctsConfig config;
+    BoardState position = BoardState::startingPosition();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--movetime" && i + 1 < args.size()) {
+            limits.moveTime = std::stoll(args[++i]);
+        } else if (args[i] == "--threads" && i + 1 < args.size()) {
+            threads = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--memory" && i + 1 < args.size()) {
+            memoryMegabytes = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--rollout" && i + 1 < args.size()) {
+            config.rolloutPlies = std::stoi(args[++i]);
+        } else if (args[i] == "--ucb1") {
+            config.selection = MctsConfig::Selection::UCB1;
+        } else if (args[i] == "--fen" && i + 1 < args.size()) {
+            position = Fen::parse(args[++i]);
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    Tree tree(Tree::capacityFor(memoryMegabytes));
+    MCTS mcts(tree, config);
+    std::unique_ptr<ThreadPool> helpers;
+    if (threads > 1) {
+        helpers = std::make_unique<ThreadPool>(threads - 1);
+    }
+    std::atomic<bool> stop(false);
+    EngineMove best = mcts.run(position, {}, limits, stop, helpers.get());
+    const MctsReport& report = mcts.getReport();
+    
+    std::cout << "Itérations " << report.playouts << "  nœuds " << report.nodes
+              << "  mémoire " << report.memory / (1024 * 1024) << " Mo" << (report.treeFull ? " (arène pleine)" : "")
+              << "  itérations/s " << static_cast<std::uint64_t>(report.playoutsPerSecond())
+              << "  collisions " << report.collisions
+              << "  temps " << static_cast<std::uint64_t>(report.seconds * 1000.0) << " ms  pv";
+    for (const EngineMove& move : report.pv) {
+        std::cout << " " << move.toString();
+    }
+    std::cout << std::endl;
+    
+    // Coups de la racine, du plus visité au moins visité
+    const Node& root = tree.getRoot();
+    std::vector<const Node*> children;
+    for (NodeIndex index = root.firstChild; root.getState() == NodeState::EXPANDED &&
+                                            index < root.firstChild + root.childCount; ++index) {
+        children.push_back(&tree[index]);
+    }
+    std::sort(children.begin(), children.end(),
+              [](const Node* a, const Node* b) { return a->getVisits() > b->getVisits(); });
+    for (size_t i = 0; i < children.size() && i < 5; ++i) {
+        EngineMove move = EngineMove::fromRaw(children[i]->move);
+        std::cout << "  " << Notation::toSan(position, move) << "  visites " << children[i]->getVisits()
+                  << "  gain " << static_cast<int>(children[i]->meanValue(0.0f) * 100.0f + 0.5f) << " %"
+                  << "  a priori " << static_cast<int>(children[i]->prior * 100.0f + 0.5f) << " %" << std::endl;
+    }
+    std::cout << "Meilleur coup: " << Notation::toUci(best) << std::endl;
+    return 0;
+}
+
+/**
+ * Mode mesure MCTS parallèle : chess mctsbench <itérations> [--threads 1,2,4,...] [--memory Mo] [--rollout N] [--fen "<FEN>"]
+ * Pour chaque nombre de threads, arbre vidé : itérations par seconde, accélération et coup choisi
+ */
+int runMctsBench(const std::vector<std::string>& args) {
+    if (args.empty()) {
+        std::cerr << "Usage: mctsbench <itérations> [--threads 1,2,4,...] [--memory Mo] [--rollout N] [--fen \"<FEN>\"]"
+                  << std::endl;
+        return 1;
+    }
+    
+    SearchLimits limits;
+    limits.nodes = std::stoull(args[0]);
+    std::vector<size_t> threadCounts = {1, 2, 4, 8, 16, 32};
+    size_t memoryMegabytes = 1024;
+    MctsConfig config;
+    BoardState position = BoardState::startingPosition();
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--threads" && i + 1 < args.size()) {
+            threadCounts.clear();
+            std::istringstream list(args[++i]);
+            std::string count;
+            while (std::getline(list, count, ',')) {
+                threadCounts.push_back(static_cast<size_t>(std::stoul(count)));
+            }
+        } else if (args[i] == "--memory" && i + 1 < args.size()) {
+            memoryMegabytes = static_cast<size_t>(std::stoul(args[++i]));
+        } else if (args[i] == "--rollout" && i + 1 < args.size()) {
+            config.rolloutPlies = std::stoi(args[++i]);
+        } else if (args[i] == "--fen" && i + 1 < args.size()) {
+            position = Fen::parse(args[++i]);
+        } else {
+            std::cerr << "Option inconnue: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+    
+    Tree tree(Tree::capacityFor(memoryMegabytes));
+    MCTS mcts(tree, config);
+    double baseRate = 0.0;
+    for (size_t threads : threadCounts) {
+        std::unique_ptr<ThreadPool> helpers;
+        if (threads > 1) {
+            helpers = std::make_unique<ThreadPool>(threads - 1);
+        }
+        
+        std::atomic<bool> stop(false);
+        EngineMove best = mcts.run(position, {}, limits, stop, helpers.get());
+        const MctsReport& report = mcts.getReport();
+        
+        if (baseRate == 0.0) {
+            baseRate = report.playoutsPerSecond();
+        }
+        std::cout << "Threads " << threads
+                  << "  itérations " << report.playouts
+                  << "  temps " << static_cast<std::uint64_t>(report.seconds * 1000.0) << " ms"
+                  << "  itérations/s " << static_cast<std::uint64_t>(report.playoutsPerSecond())
+                  << " (x" << (baseRate > 0.0 ? report.playoutsPerSecond() / baseRate : 0.0) << ")"
+                  << "  collisions " << report.collisions
+                  << "  nœuds " << report.nodes << (report.treeFull ? " (arène pleine)" : "")
+                  << "  coup " << Notation::toUci(best)
+                  << " (" << (report.playouts > 0 ? report.bestVisits * 100 / report.playouts : 0) << " % des visites)"
+                  << std::endl;
+    }
+    return 0;
+}
+
 /**
  * Fonction principale
  */
-int main() {
+int main(int argc, char* argv[]) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+    
+    // Mode moteur : chess uci (dialogue avec une interface graphique sur stdin/stdout)
+    if (!args.empty() && args[0] == "uci") {
+        UciProtocol protocol;
+        protocol.run();
+        return 0;
+    }
+    
+    if (!args.empty() && (args[0] == "perft" || args[0] == "fenload" || args[0] == "pgn" || args[0] == "search" ||
+                          args[0] == "smp" || args[0] == "see" || args[0] == "nnue" ||
+                          args[0] == "mcts" || args[0] == "mctsbench")) {
+        std::vector<std::string> options(args.begin() + 1, args.end());
+        try {
+            if (args[0] == "pgn") {
+                return runPgnReplay(options);
+            }
+            if (args[0] == "search") {
+                return runSearch(options);
+            }
+            if (args[0] == "smp") {
+                return runSmpBench(options);
+            }
+            if (args[0] == "see") {
+                return runSee(options);
+            }
+            if (args[0] == "nnue") {
+                return runNnue(options);
+            }
+            if (args[0] == "mcts") {
+                return runMcts(options);
+            }
+            if (args[0] == "mctsbench") {
+                return runMctsBench(options);
+            }
+            return args[0] == "perft" ? runPerft(options) : runFenLoad(options);
+        } catch (const std::exception& e) {
+            std::cerr << "Erreur fatale: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+    
     try {
         std::cout << "Initialisation du jeu..." << std::endl;
         Game game;
+        std::unique_ptr<TranspositionTable> engineTable;  // Table du moteur (commande "go")
         std::cout << "Jeu initialisé avec succès!" << std::endl;
         std::string input;
         
         std::cout << "=== JEU D'ÉCHECS ===" << std::endl;
-        std::cout << "Entrez vos mouvements au format 'e2 e4' ou 'quit' pour quitter" << std::endl;
+        std::cout << "Entrez vos mouvements au format 'e2 e4', 'e2e4' ou 'Nf3', ou 'quit' pour quitter" << std::endl;
+        std::cout << "'fen' affiche la position, 'fen <FEN>' en charge une autre" << std::endl;
+        std::cout << "'go' fait jouer le moteur pour le joueur actuel" << std::endl;
         std::cout << "Les blancs commencent!" << std::endl << std::endl;
         
         while (true) {
             game.displayBoard();
             game.displayScores();
             
+            if (game.isGameOver()) {
+                std::cout << describeGameEnd(game) << std::endl;
+                break;
+            }
+            if (game.getGameState() == GameState::CHECK) {
+                std::cout << "Échec !" << std::endl;
+            }
+            
             const Player* currentPlayer = game.getCurrentPlayer();
             std::cout << "Au tour des " << (currentPlayer->isWhite() ? "Blancs" : "Noirs") << std::endl;
             std::cout << "Votre mouvement: ";
@@ -63,10 +733,39 @@ int main() {
             }
             
             try {
-                // Parse le mouvement
+                // "fen" affiche la position courante, "fen <FEN>" en charge une autre
+                if (input == "fen") {
+                    std::cout << game.toFen() << std::endl << std::endl;
+                    continue;
+                }
+                if (input.compare(0, 4, "fen ") == 0) {
+                    game.loadFen(input.substr(4));
+                    std::cout << "Position chargée." << std::endl << std::endl;
+                    continue;
+                }
+                
+                // "go" : le moteur joue pour le joueur actuel
+                if (input == "go") {
+                    SearchLimits limits;
+                    limits.moveTime = 1000;
+                    EngineMove move = findBestMove(game, engineTable, limits);
+                    std::string san = game.toSan(move);
+                    if (game.makeMove(move)) {
+                        std::cout << "Le moteur joue: " << san << std::endl << std::endl;
+                    }
+                    continue;
+                }
+                
+                // Parse le mouvement : "e2 e4", ou un seul mot en UCI ("e2e4") ou SAN ("Nf3")
                 size_t spacePos = input.find(' ');
                 if (spacePos == std::string::npos) {
-                    std::cout << "Format invalide! Utilisez: e2 e4" << std::endl;
+                    EngineMove move = game.parseMove(input);
+                    std::string san = game.toSan(move);
+                    if (game.makeMove(move)) {
+                        std::cout << "Mouvement effectué: " << san << std::endl << std::endl;
+                    } else {
+                        std::cout << "Erreur inattendue lors du mouvement!" << std::endl;
+                    }
                     continue;
                 }
                 
@@ -0,0 +1,447 @@
+#ifndef MCTS_HPP
+#define MCTS_HPP
+
+#include "Tree/Node.hpp"
+#include "Tree/Tree.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/MoveGenerator.hpp"
+#include "../Core/Zobrist.hpp"
+#include "../Engine/Evaluation.hpp"
+#include "../Engine/SearchLimits.hpp"
+#include "../Engine/StaticExchange.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/MoveList.hpp"
+#include "../Utils/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+/**
+ * Réglages de la recherche MCTS
+ */
+struct MctsConfig {
+    enum class Selection { UCB1, PUCT };
+
+    Selection selection = Selection::PUCT;
+    float exploration = 0.0f;   // Constante d'exploration ; 0 : valeur usuelle de la formule choisie
+    int rolloutPlies = 0;       // Coups aléatoires joués depuis une feuille avant de l'évaluer
+    int virtualLoss = 3;        // Défaites fictives comptées par thread en cours de descente
+
+    float explorationConstant() const {
+        if (exploration > 0.0f) {
+            return exploration;
+        }
+        return selection == Selection::UCB1 ? 1.41f : 1.5f;
+    }
+};
+
+/**
+ * Bilan d'une recherche MCTS
+ */
+struct MctsReport {
+    std::uint64_t playouts = 0;
+    size_t nodes = 0;             // Nœuds de l'arbre
+    size_t memory = 0;            // Octets occupés dans l'arène
+    bool treeFull = false;        // Recherche arrêtée faute de place dans l'arène
+    size_t threads = 1;
+    std::uint64_t collisions = 0; // Feuilles déjà en cours d'expansion par un autre thread
+    double seconds = 0.0;
+    std::vector<EngineMove> pv;   // Suite des coups les plus visités
+    std::uint32_t bestVisits = 0;
+    float bestValue = 0.0f;       // Résultat moyen du meilleur coup pour le camp au trait (0 à 1)
+
+    double playoutsPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(playouts) / seconds : 0.0;
+    }
+};
+
+/**
+ * Recherche arborescente Monte-Carlo (sélection, expansion, simulation, rétropropagation)
+ *
+ * Chaque itération descend de la racine en choisissant l'enfant de meilleur score
+ * (UCB1, ou PUCT avec des probabilités a priori), crée tous les enfants de la feuille
+ * atteinte, l'évalue puis remonte le résultat le long du chemin. Faute de réseau de
+ * politique, les probabilités a priori favorisent les captures gagnantes (SEE) et les
+ * promotions ; faute de réseau de valeur, la feuille est jugée par l'évaluation statique,
+ * convertie en espérance de gain, après d'éventuels coups aléatoires (rolloutPlies).
+ *
+ * Parallélisme sur l'arbre : le thread appelant et ceux du ThreadPool descendent le même
+ * arbre. Chaque thread compte des défaites fictives (perte virtuelle) sur les nœuds qu'il
+ * traverse, ce qui détourne les autres vers d'autres branches jusqu'à sa rétropropagation.
+ * Les statistiques sont atomiques et l'expansion se réserve par compare-and-swap : aucun
+ * verrou. Un thread qui trouve une feuille en cours d'expansion l'évalue sans l'attendre.
+ *
+ * L'arbre appartient à l'appelant : il est vidé (en O(1)) au début de chaque recherche.
+ */
+class MCTS {
+private:
+    /**
+     * État propre à un thread : position de travail, évaluateur (table de pions) et hasard
+     */
+    struct Worker {
+        std::unique_ptr<Evaluator> evaluator;
+        std::mt19937 random;
+        // Clés des positions précédant la racine, puis du chemin en cours (répétitions)
+        std::vector<Zobrist::Key> keys;
+        std::uint64_t collisions = 0;
+
+        explicit Worker(std::uint32_t seed) : evaluator(std::make_unique<Evaluator>()), random(seed) {}
+    };
+
+    Tree& tree_;
+    MctsConfig config_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    BoardState root_;
+    std::chrono::steady_clock::time_point start_;
+    std::atomic<std::uint64_t> playouts_;
+    std::atomic<bool> done_;   // Fin de la recherche, levé par le thread appelant
+    std::atomic<bool> full_;   // Arène pleine
+    // Perte virtuelle de la recherche en cours : nulle sur un seul thread, qui n'a personne à écarter
+    int virtualLoss_;
+    MctsReport report_;
+
+    static constexpr int MAX_DEPTH = 256;
+    static constexpr int CLOCK_CHECK_INTERVAL = 256;
+    // Un coup jamais essayé part du résultat de son père, diminué de cette marge (PUCT)
+    static constexpr float FIRST_PLAY_REDUCTION = 0.1f;
+    // Centipions qui donnent environ 64 % de chances de gain (échelle de l'espérance de gain)
+    static constexpr double VALUE_SCALE = 400.0;
+
+public:
+    MCTS(Tree& tree, const MctsConfig& config = MctsConfig())
+        : tree_(tree), config_(config), root_(BoardState::startingPosition()), playouts_(0), done_(false),
+          full_(false), virtualLoss_(0) {}
+
+    /**
+     * Lance la recherche
+     * @param history Clés des positions précédant la racine depuis le dernier coup irréversible
+     * @param limits Nombre d'itérations (nodes) et/ou temps ; sans limite, jusqu'à stop ou arène pleine.
+     *               Les threads finissent leur itération en cours : le total peut dépasser nodes de peu.
+     * @param helpers Threads qui explorent le même arbre, ou nullptr pour le seul thread appelant
+     * @return Le coup le plus visité, ou EngineMove::none() s'il n'y a aucun coup légal
+     */
+    EngineMove run(const BoardState& root, const std::vector<Zobrist::Key>& history, const SearchLimits& limits,
+                   const std::atomic<bool>& stop, ThreadPool* helpers = nullptr) {
+        start_ = std::chrono::steady_clock::now();
+        tree_.reset();
+        root_ = root;
+        playouts_.store(0, std::memory_order_relaxed);
+        done_ = false;
+        full_ = false;
+        report_ = MctsReport();
+
+        size_t threads = 1 + (helpers ? helpers->size() : 0);
+        virtualLoss_ = threads > 1 ? config_.virtualLoss : 0;
+        while (workers_.size() < threads) {
+            workers_.push_back(std::make_unique<Worker>(static_cast<std::uint32_t>(workers_.size()) + 1));
+        }
+        for (size_t i = 0; i < threads; ++i) {
+            workers_[i]->keys = history;
+            workers_[i]->keys.reserve(history.size() + MAX_DEPTH);
+            workers_[i]->collisions = 0;
+        }
+
+        // La racine est développée avant l'arrivée des assistants : sans coup légal, rien à chercher
+        if (!playout(*workers_[0]) || tree_.getRoot().isTerminal()) {
+            return finish(threads);
+        }
+        for (size_t i = 1; i < threads; ++i) {
+            Worker* worker = workers_[i].get();
+            helpers->submit([this, worker, maxPlayouts = limits.nodes] {
+                while (!done_.load(std::memory_order_relaxed) && !reached(maxPlayouts) && playout(*worker)) {
+                }
+            });
+        }
+
+        // Le thread appelant applique seul les limites de temps et l'arrêt
+        std::int64_t timeLimit = limits.allocatedTime(root.getSideToMove(), 0);
+        std::uint64_t ownPlayouts = 1;
+        while (!stop.load(std::memory_order_relaxed) && !reached(limits.nodes)) {
+            if (timeLimit > 0 && ownPlayouts % CLOCK_CHECK_INTERVAL == 0 &&
+                elapsedSeconds() * 1000.0 >= static_cast<double>(timeLimit)) {
+                break;
+            }
+            if (!playout(*workers_[0])) {
+                break;
+            }
+            ++ownPlayouts;
+        }
+        done_ = true;
+        if (helpers) {
+            helpers->wait();
+        }
+        return finish(threads);
+    }
+
+    const MctsReport& getReport() const { return report_; }
+
+    const Tree& getTree() const { return tree_; }
+
+private:
+    bool reached(std::uint64_t maxPlayouts) const {
+        return maxPlayouts > 0 && playouts_.load(std::memory_order_relaxed) >= maxPlayouts;
+    }
+
+    /**
+     * Bilan et coup choisi, une fois tous les threads arrêtés
+     */
+    EngineMove finish(size_t threads) {
+        report_.seconds = elapsedSeconds();
+        report_.playouts = playouts_.load(std::memory_order_relaxed);
+        report_.nodes = tree_.size();
+        report_.memory = tree_.memoryUsage();
+        report_.treeFull = full_.load(std::memory_order_relaxed);
+        report_.threads = threads;
+        for (size_t i = 0; i < threads; ++i) {
+            report_.collisions += workers_[i]->collisions;
+        }
+
+        NodeIndex best = mostVisitedChild(Tree::ROOT);
+        if (best == NO_NODE) {
+            return EngineMove::none();
+        }
+        report_.bestVisits = tree_[best].getVisits();
+        report_.bestValue = tree_[best].meanValue(0.5f);
+        for (NodeIndex index = best; index != NO_NODE; index = mostVisitedChild(index)) {
+            report_.pv.push_back(EngineMove::fromRaw(tree_[index].move));
+        }
+        return EngineMove::fromRaw(tree_[best].move);
+    }
+
+    /**
+     * Une itération complète
+     * @return false si l'arène est pleine : la recherche doit s'arrêter
+     */
+    bool playout(Worker& worker) {
+        BoardState state = root_;
+        size_t historySize = worker.keys.size();
+        NodeIndex path[MAX_DEPTH];
+        int length = 0;
+        path[length++] = Tree::ROOT;
+        addVirtualLoss(tree_.getRoot());
+
+        // Sélection, en marquant le chemin d'une perte virtuelle
+        NodeIndex current = Tree::ROOT;
+        UndoInfo undo;
+        while (tree_[current].getState() == NodeState::EXPANDED && length < MAX_DEPTH) {
+            current = selectChild(tree_[current]);
+            addVirtualLoss(tree_[current]);
+            worker.keys.push_back(state.getHash());
+            state.makeMove(EngineMove::fromRaw(tree_[current].move), undo);
+            path[length++] = current;
+        }
+
+        // Expansion par un seul thread, puis simulation : résultat pour le camp au trait sur la feuille
+        Node& leaf = tree_[current];
+        NodeState expected = NodeState::LEAF;
+        bool expanded = true;
+        if (leaf.state.compare_exchange_strong(expected, NodeState::EXPANDING, std::memory_order_acq_rel)) {
+            expanded = expand(leaf, state, worker);
+        } else if (expected == NodeState::EXPANDING) {
+            ++worker.collisions;
+        }
+        float value;
+        switch (leaf.getState()) {
+            case NodeState::LOST:
+                value = 0.0f;
+                break;
+            case NodeState::DRAWN:
+                value = 0.5f;
+                break;
+            default:
+                value = simulate(state, worker);
+                break;
+        }
+        worker.keys.resize(historySize);
+
+        // Rétropropagation : chaque nœud compte le résultat du camp qui y a mené
+        for (int i = length - 1; i >= 0; --i) {
+            Node& node = tree_[path[i]];
+            node.addResult(1.0f - value);
+            if (virtualLoss_ > 0) {
+                node.virtualLoss.fetch_sub(1, std::memory_order_relaxed);
+            }
+            value = 1.0f - value;
+        }
+        playouts_.fetch_add(1, std::memory_order_relaxed);
+        if (!expanded) {
+            full_ = true;
+        }
+        return expanded && !full_.load(std::memory_order_relaxed);
+    }
+
+    void addVirtualLoss(Node& node) const {
+        if (virtualLoss_ > 0) {
+            node.virtualLoss.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Enfant au meilleur score de sélection (le nœud doit avoir des enfants)
+     * Chaque thread en cours de descente compte pour virtualLoss visites perdues.
+     */
+    NodeIndex selectChild(const Node& parent) const {
+        float c = config_.explorationConstant();
+        float virtualLoss = static_cast<float>(virtualLoss_);
+        float parentVisits = static_cast<float>(parent.getVisits()) +
+                             virtualLoss * static_cast<float>(parent.virtualLoss.load(std::memory_order_relaxed));
+        NodeIndex best = parent.firstChild;
+        float bestScore = -1.0f;
+
+        // PUCT : le résultat du père est compté pour l'adversaire de celui qui choisit
+        float firstPlay = std::max(0.0f, 1.0f - parent.meanValue(0.5f) - FIRST_PLAY_REDUCTION);
+        float exploration = config_.selection == MctsConfig::Selection::UCB1
+                                ? c * std::sqrt(std::log(std::max(parentVisits, 1.0f)))
+                                : c * std::sqrt(parentVisits);
+        for (NodeIndex index = parent.firstChild; index < parent.firstChild + parent.childCount; ++index) {
+            const Node& child = tree_[index];
+            float visits = static_cast<float>(child.getVisits()) +
+                           virtualLoss * static_cast<float>(child.virtualLoss.load(std::memory_order_relaxed));
+            float wins = static_cast<float>(child.valueSum.load(std::memory_order_relaxed)) /
+                         static_cast<float>(Node::VALUE_ONE);
+            float score;
+            if (config_.selection == MctsConfig::Selection::UCB1) {
+                // UCB1 essaie chaque coup une fois avant de comparer
+                if (visits == 0.0f) {
+                    return index;
+                }
+                score = wins / visits + exploration / std::sqrt(visits);
+            } else {
+                score = (visits > 0.0f ? wins / visits : firstPlay) + exploration * child.prior / (1.0f + visits);
+            }
+            if (score > bestScore) {
+                bestScore = score;
+                best = index;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Crée les enfants d'une feuille réservée (EXPANDING), ou la marque comme position finale
+     * @return false si l'arène n'a plus la place pour ses enfants (la feuille le reste)
+     */
+    bool expand(Node& node, const BoardState& state, const Worker& worker) {
+        if (isDraw(state, worker.keys)) {
+            node.state.store(NodeState::DRAWN, std::memory_order_release);
+            return true;
+        }
+        MoveList moves;
+        MoveGenerator::generateLegalMoves(state, moves);
+        if (moves.empty()) {
+            node.state.store(state.isInCheck(state.getSideToMove()) ? NodeState::LOST : NodeState::DRAWN,
+                             std::memory_order_release);
+            return true;
+        }
+
+        NodeIndex first = tree_.allocate(static_cast<size_t>(moves.size()));
+        if (first == NO_NODE) {
+            node.state.store(NodeState::LEAF, std::memory_order_release);
+            return false;
+        }
+        float weights[MoveList::MAX_MOVES];
+        float total = 0.0f;
+        for (int i = 0; i < moves.size(); ++i) {
+            weights[i] = priorWeight(state, moves[i]);
+            total += weights[i];
+        }
+        for (int i = 0; i < moves.size(); ++i) {
+            tree_[first + i].init(moves[i].getRaw(), weights[i] / total);
+        }
+        node.firstChild = first;
+        node.childCount = static_cast<std::uint16_t>(moves.size());
+        // Publie les enfants : qui voit EXPANDED voit aussi firstChild, childCount et leur contenu
+        node.state.store(NodeState::EXPANDED, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Poids a priori d'un coup : les captures qui gagnent du matériel et les promotions d'abord
+     */
+    static float priorWeight(const BoardState& state, const EngineMove& move) {
+        float weight = 1.0f;
+        if (move.isPromotion()) {
+            weight += move.getPromotion() == PieceType::QUEEN ? 4.0f : 0.0f;
+        }
+        if (move.isEnPassant() || (!move.isCastling() && !state.isEmpty(move.getTo()))) {
+            int gain = StaticExchange::evaluate(state, move);
+            if (gain >= 0) {
+                weight += 1.0f + static_cast<float>(gain) / 100.0f;
+            }
+        }
+        return weight;
+    }
+
+    /**
+     * Espérance de gain du camp au trait (0 à 1), après rolloutPlies coups aléatoires
+     */
+    float simulate(BoardState state, Worker& worker) const {
+        UndoInfo undo;
+        bool flipped = false;
+        for (int ply = 0; ply < config_.rolloutPlies; ++ply) {
+            MoveList moves;
+            MoveGenerator::generateLegalMoves(state, moves);
+            if (moves.empty()) {
+                float value = state.isInCheck(state.getSideToMove()) ? 0.0f : 0.5f;
+                return flipped ? 1.0f - value : value;
+            }
+            if (state.getHalfmoveClock() >= 100) {
+                return 0.5f;
+            }
+            state.makeMove(moves[static_cast<int>(worker.random() % static_cast<unsigned>(moves.size()))], undo);
+            flipped = !flipped;
+        }
+        float value = winProbability(worker.evaluator->evaluate(state));
+        return flipped ? 1.0f - value : value;
+    }
+
+    static float winProbability(int centipawns) {
+        return static_cast<float>(1.0 / (1.0 + std::pow(10.0, -centipawns / VALUE_SCALE)));
+    }
+
+    /**
+     * Nulle par la règle des 50 coups ou par répétition d'une position du chemin ou de l'historique
+     */
+    static bool isDraw(const BoardState& state, const std::vector<Zobrist::Key>& keys) {
+        int clock = state.getHalfmoveClock();
+        if (clock >= 100) {
+            return true;
+        }
+        Zobrist::Key key = state.getHash();
+        int last = static_cast<int>(keys.size()) - 1;
+        for (int i = last - 1; i >= 0 && i >= last - clock + 1; i -= 2) {
+            if (keys[i] == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    NodeIndex mostVisitedChild(NodeIndex index) const {
+        const Node& node = tree_[index];
+        if (node.getState() != NodeState::EXPANDED) {
+            return NO_NODE;
+        }
+        NodeIndex best = NO_NODE;
+        std::uint32_t bestVisits = 0;
+        for (NodeIndex child = node.firstChild; child < node.firstChild + node.childCount; ++child) {
+            if (tree_[child].getVisits() > bestVisits) {
+                bestVisits = tree_[child].getVisits();
+                best = child;
+            }
+        }
+        return best;
+    }
+
+    double elapsedSeconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+};
+
+#endif // MCTS_HPP
\ No newline at end of file
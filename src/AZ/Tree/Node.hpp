@@ -1,58 +1,98 @@
 #ifndef NODE_HPP
 #define NODE_HPP
 
-#include <vector>
-#include <string>
-#include "../Players/Player.hpp"
-
-class Node {
-    public :
-
-    Node* parent;
-    Node** child;
-    GameState state;
-    int visitCount;
-    float winScore;
-    int childArraySize;
-    Color playerNo;
-    Piece* pieceMoved;
-    Action action;
-
-
-    Node();
-    Node(State state);
-    Node(State state, Color playerNo);
-    ~Node();
-    Node* getRandomChildNode();
-    Node* getChildWithMaxScore();
-    void incrementVisit();
-    void addScore(float score);
-    void setState(State state);
-    State getState();
-    Player getCurrentPlayer();
-    void setParent(Node* parent);
-    void setPieceMoved(Piece* piece);
-    Piece* getPieceMoved();
-    Action getAction();
-    void setAction(Action action);
-    void setChildArraySize(int size);
-    int getChildArraySize();
-    int getVisitCount();
-    float getWinScore();
-    bool isLeaf() const;
-    bool isFullyExpanded() const;
-    double getUCB1Value(double c = 1.41) const;
-    Node* selectBestChild() const;
-    void expand(const std::vector<Action>& possibleActions);
-    void backpropagate(float result);
-    bool isTerminal() const;
-    Node* addChild(const Action& action, const State& newState);
-    void removeChild(Node* child);
-    std::vector<Node*> getChildren() const;
-    void printTree(int depth = 0) const;
-    std::string toString() const;
-    
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Index d'un nœud dans l'arène de l'arbre (Tree)
+ */
+using NodeIndex = std::uint32_t;
+
+constexpr NodeIndex NO_NODE = 0xFFFFFFFFu;
+
+/**
+ * État d'un nœud de l'arbre MCTS
+ */
+enum class NodeState : std::uint8_t {
+    LEAF,        // Enfants pas encore créés
+    EXPANDING,   // Un thread est en train de créer les enfants
+    EXPANDED,    // Enfants créés (childCount coups légaux)
+    LOST,        // Position finale : le camp au trait est mat
+    DRAWN        // Position finale : pat, 50 coups ou répétition
+};
+
+/**
+ * Nœud de l'arbre MCTS (32 octets), partagé par tous les threads de recherche
+ *
+ * Les nœuds vivent dans l'arène de Tree : pas de pointeurs, les enfants d'un nœud
+ * sont les childCount nœuds consécutifs à partir de firstChild. Le coup qui mène
+ * au nœud est gardé sous sa forme compacte de 16 bits (EngineMove::getRaw).
+ * Les résultats sont comptés du point de vue du camp qui a joué ce coup :
+ * c'est celui qui choisit entre les frères.
+ *
+ * Les statistiques sont atomiques ; la somme des résultats est en virgule fixe
+ * (VALUE_ONE pour un gain) pour s'additionner sans verrou. Un seul thread crée les
+ * enfants : celui qui fait passer state de LEAF à EXPANDING. firstChild et childCount
+ * ne sont lus qu'après avoir vu EXPANDED (publié en release, lu en acquire).
+ */
+struct Node {
+    static constexpr std::uint64_t VALUE_ONE = 1 << 16;
+
+    std::atomic<std::uint64_t> valueSum;    // Somme des résultats (VALUE_ONE gain, VALUE_ONE / 2 nulle, 0 perte)
+    NodeIndex firstChild;
+    std::atomic<std::uint32_t> visits;
+    float prior;                            // Probabilité a priori du coup parmi ses frères (PUCT)
+    std::uint16_t childCount;
+    std::uint16_t move;
+    std::atomic<std::uint16_t> virtualLoss; // Threads en train de descendre par ce nœud
+    std::atomic<NodeState> state;
+
+    /**
+     * (Ré)initialise un nœud neuf, sans visite ni enfant
+     */
+    void init(std::uint16_t code, float probability) {
+        valueSum.store(0, std::memory_order_relaxed);
+        firstChild = NO_NODE;
+        visits.store(0, std::memory_order_relaxed);
+        prior = probability;
+        childCount = 0;
+        move = code;
+        virtualLoss.store(0, std::memory_order_relaxed);
+        state.store(NodeState::LEAF, std::memory_order_relaxed);
+    }
+
+    NodeState getState() const { return state.load(std::memory_order_acquire); }
+
+    bool isTerminal() const {
+        NodeState current = getState();
+        return current == NodeState::LOST || current == NodeState::DRAWN;
+    }
+
+    std::uint32_t getVisits() const { return visits.load(std::memory_order_relaxed); }
+
+    /**
+     * Résultat moyen (0 à 1) pour le camp qui a joué le coup (sans visite : fallback)
+     */
+    float meanValue(float fallback) const {
+        std::uint32_t count = getVisits();
+        return count > 0 ? static_cast<float>(valueSum.load(std::memory_order_relaxed)) /
+                               (static_cast<float>(VALUE_ONE) * static_cast<float>(count))
+                         : fallback;
+    }
+
+    /**
+     * Ajoute un résultat (0 à 1) pour le camp qui a joué le coup
+     */
+    void addResult(float value) {
+        valueSum.fetch_add(static_cast<std::uint64_t>(value * static_cast<float>(VALUE_ONE) + 0.5f),
+                           std::memory_order_relaxed);
+        visits.fetch_add(1, std::memory_order_relaxed);
+    }
 };
 
+static_assert(sizeof(Node) <= 32, "Node doit rester compact : l'arène en contient des millions");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<NodeState>::is_always_lock_free,
+              "Les statistiques des nœuds doivent être atomiques sans verrou");
 
-#endif
\ No newline at end of file
+#endif // NODE_HPP
\ No newline at end of file
@@ -2,29 +2,82 @@
 #define TREE_HPP
 
 #include "Node.hpp"
+#include "../../Utils/EngineMove.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * Arbre MCTS stocké dans une arène de nœuds contiguë
+ *
+ * La capacité est réservée une fois pour toutes ; les nœuds sont distribués du début
+ * vers la fin et jamais rendus un par un : vider l'arbre consiste à remettre le compteur
+ * à un (la racine), en O(1). Le tableau n'est pas initialisé à l'allocation, si bien
+ * que seules les pages effectivement atteintes par la recherche occupent de la mémoire.
+ * Plusieurs threads peuvent réserver des nœuds en même temps (compteur atomique) ;
+ * reset() ne doit être appelé qu'en dehors d'une recherche.
+ */
+class Tree {
+private:
+    std::unique_ptr<Node[]> nodes_;
+    size_t capacity_;
+    std::atomic<size_t> size_;
 
-class Tree{
 public:
-    Node* root;
+    static constexpr NodeIndex ROOT = 0;
 
-    Tree(const State& initialState) {
-        root = new Node(initialState);
+    /**
+     * Constructeur
+     * @param capacity Nombre maximal de nœuds (au moins 1, au plus NO_NODE)
+     */
+    explicit Tree(size_t capacity)
+        : capacity_(std::clamp<size_t>(capacity, 1, NO_NODE)), size_(0) {
+        nodes_.reset(new Node[capacity_]);
+        reset();
     }
 
-    ~Tree() {
-        delete root;
+    /**
+     * Capacité qui tient dans un budget mémoire
+     */
+    static size_t capacityFor(size_t megabytes) {
+        return megabytes * 1024 * 1024 / sizeof(Node);
     }
 
-    Node* getRoot() const {
-        return root;
+    /**
+     * Vide l'arbre (O(1)) : il ne reste qu'une racine neuve
+     */
+    void reset() {
+        nodes_[ROOT].init(EngineMove::none().getRaw(), 1.0f);
+        size_.store(1, std::memory_order_relaxed);
     }
 
-    void setRoot(Node* newRoot) {
-        if (root) {
-            delete root;
+    /**
+     * Réserve count nœuds consécutifs
+     * @return Index du premier, ou NO_NODE si l'arène est pleine
+     */
+    NodeIndex allocate(size_t count) {
+        // Une réservation refusée laisse le compteur au-delà de la capacité : l'arène reste pleine
+        size_t first = size_.fetch_add(count, std::memory_order_relaxed);
+        if (first + count > capacity_) {
+            return NO_NODE;
         }
-        root = newRoot;
+        return static_cast<NodeIndex>(first);
     }
+
+    Node& operator[](NodeIndex index) { return nodes_[index]; }
+    const Node& operator[](NodeIndex index) const { return nodes_[index]; }
+
+    Node& getRoot() { return nodes_[ROOT]; }
+    const Node& getRoot() const { return nodes_[ROOT]; }
+
+    size_t size() const { return std::min(size_.load(std::memory_order_relaxed), capacity_); }
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * Mémoire occupée par les nœuds utilisés (octets)
+     */
+    size_t memoryUsage() const { return size() * sizeof(Node); }
 };
 
-#endif
\ No newline at end of file
+#endif // TREE_HPP
\ No newline at end of file
@@ -0,0 +1,324 @@
+#ifndef ATTACKS_HPP
+#define ATTACKS_HPP
+
+#include "Bitboard.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/PieceType.hpp"
+#include <array>
+#include <cstdint>
+
+// PEXT (BMI2) remplace la multiplication magique quand le compilateur cible ce jeu d'instructions.
+// Définir CHESS_NO_PEXT force les nombres magiques (utile sur les CPU où PEXT est microcodé).
+#if defined(__BMI2__) && !defined(CHESS_NO_PEXT)
+#define CHESS_USE_PEXT 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Tables d'attaque précalculées
+ * Les sauteurs (cavalier, roi, pion) et les rayons entre cases sont calculés à la compilation,
+ * les pièces glissantes (tour, fou, dame) au démarrage via des bitboards magiques.
+ */
+namespace Attacks {
+
+    namespace detail {
+
+        constexpr int ROOK_DIRECTIONS[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+        constexpr int BISHOP_DIRECTIONS[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+        constexpr bool onBoard(int x, int y) {
+            return x >= 0 && x < ChessConstants::BOARD_SIZE && y >= 0 && y < ChessConstants::BOARD_SIZE;
+        }
+
+        /**
+         * Attaques d'une pièce glissante calculées case par case
+         * Sert uniquement à remplir les tables
+         */
+        constexpr Bitboard slidingAttacks(int square, Bitboard occupancy, const int (&directions)[4][2]) {
+            Bitboard attacks = Bitboards::EMPTY;
+            for (const auto& direction : directions) {
+                int x = Bitboards::fileOf(square) + direction[0];
+                int y = Bitboards::rankOf(square) + direction[1];
+                while (onBoard(x, y)) {
+                    int target = Bitboards::squareIndex(x, y);
+                    attacks |= Bitboards::squareBB(target);
+                    if (Bitboards::contains(occupancy, target)) {
+                        break;
+                    }
+                    x += direction[0];
+                    y += direction[1];
+                }
+            }
+            return attacks;
+        }
+
+        template <std::size_t N>
+        constexpr std::array<Bitboard, Bitboards::SQUARE_COUNT> leaperTable(const int (&offsets)[N][2]) {
+            std::array<Bitboard, Bitboards::SQUARE_COUNT> table{};
+            for (int square = 0; square < Bitboards::SQUARE_COUNT; ++square) {
+                for (const auto& offset : offsets) {
+                    int x = Bitboards::fileOf(square) + offset[0];
+                    int y = Bitboards::rankOf(square) + offset[1];
+                    if (onBoard(x, y)) {
+                        table[square] |= Bitboards::squareBB(Bitboards::squareIndex(x, y));
+                    }
+                }
+            }
+            return table;
+        }
+
+        constexpr int KNIGHT_OFFSETS[8][2] = {{1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2}};
+        constexpr int KING_OFFSETS[8][2] = {{1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+        constexpr int WHITE_PAWN_OFFSETS[2][2] = {{-1, 1}, {1, 1}};
+        constexpr int BLACK_PAWN_OFFSETS[2][2] = {{-1, -1}, {1, -1}};
+
+        constexpr std::array<Bitboard, Bitboards::SQUARE_COUNT> KNIGHT = leaperTable(KNIGHT_OFFSETS);
+        constexpr std::array<Bitboard, Bitboards::SQUARE_COUNT> KING = leaperTable(KING_OFFSETS);
+        constexpr std::array<std::array<Bitboard, Bitboards::SQUARE_COUNT>, 2> PAWN = {
+            leaperTable(WHITE_PAWN_OFFSETS), leaperTable(BLACK_PAWN_OFFSETS)
+        };
+
+        /**
+         * Cases strictement entre deux cases alignées (vide si elles ne le sont pas)
+         */
+        constexpr std::array<std::array<Bitboard, Bitboards::SQUARE_COUNT>, Bitboards::SQUARE_COUNT> betweenTable() {
+            std::array<std::array<Bitboard, Bitboards::SQUARE_COUNT>, Bitboards::SQUARE_COUNT> table{};
+            for (int from = 0; from < Bitboards::SQUARE_COUNT; ++from) {
+                for (const auto& direction : KING_OFFSETS) {
+                    Bitboard path = Bitboards::EMPTY;
+                    int x = Bitboards::fileOf(from) + direction[0];
+                    int y = Bitboards::rankOf(from) + direction[1];
+                    while (onBoard(x, y)) {
+                        int to = Bitboards::squareIndex(x, y);
+                        table[from][to] = path;
+                        path |= Bitboards::squareBB(to);
+                        x += direction[0];
+                        y += direction[1];
+                    }
+                }
+            }
+            return table;
+        }
+
+        /**
+         * Ligne complète (bord à bord) passant par deux cases alignées, vide sinon
+         */
+        constexpr std::array<std::array<Bitboard, Bitboards::SQUARE_COUNT>, Bitboards::SQUARE_COUNT> lineTable() {
+            std::array<std::array<Bitboard, Bitboards::SQUARE_COUNT>, Bitboards::SQUARE_COUNT> table{};
+            for (int from = 0; from < Bitboards::SQUARE_COUNT; ++from) {
+                for (int axis = 0; axis < 4; ++axis) {
+                    // Directions opposées : KING_OFFSETS[axis] et KING_OFFSETS[axis + 4]
+                    Bitboard line = Bitboards::squareBB(from);
+                    for (int side = 0; side < 2; ++side) {
+                        const auto& direction = KING_OFFSETS[axis + 4 * side];
+                        int x = Bitboards::fileOf(from) + direction[0];
+                        int y = Bitboards::rankOf(from) + direction[1];
+                        while (onBoard(x, y)) {
+                            line |= Bitboards::squareBB(Bitboards::squareIndex(x, y));
+                            x += direction[0];
+                            y += direction[1];
+                        }
+                    }
+                    for (int to = 0; to < Bitboards::SQUARE_COUNT; ++to) {
+                        if (to != from && Bitboards::contains(line, to)) {
+                            table[from][to] = line;
+                        }
+                    }
+                }
+            }
+            return table;
+        }
+
+        constexpr std::array<std::array<Bitboard, Bitboards::SQUARE_COUNT>, Bitboards::SQUARE_COUNT> BETWEEN = betweenTable();
+        constexpr std::array<std::array<Bitboard, Bitboards::SQUARE_COUNT>, Bitboards::SQUARE_COUNT> LINE = lineTable();
+
+        /**
+         * Entrée magique d'une case : masque des cases pertinentes et accès à la table
+         */
+        struct Magic {
+            Bitboard mask;
+            Bitboard magic;
+            const Bitboard* attacks;
+            unsigned shift;
+
+            unsigned index(Bitboard occupancy) const {
+#if defined(CHESS_USE_PEXT)
+                return static_cast<unsigned>(_pext_u64(occupancy, mask));
+#else
+                return static_cast<unsigned>(((occupancy & mask) * magic) >> shift);
+#endif
+            }
+        };
+
+        /**
+         * Générateur pseudo-aléatoire déterministe (xorshift64*) pour la recherche des nombres magiques
+         */
+        class MagicRandom {
+        private:
+            std::uint64_t state_;
+
+        public:
+            explicit MagicRandom(std::uint64_t seed) : state_(seed) {}
+
+            std::uint64_t next() {
+                state_ ^= state_ >> 12;
+                state_ ^= state_ << 25;
+                state_ ^= state_ >> 27;
+                return state_ * 2685821657736338717ULL;
+            }
+
+            // Peu de bits à 1 : converge beaucoup plus vite vers un nombre magique valide
+            std::uint64_t sparse() {
+                return next() & next() & next();
+            }
+        };
+
+        /**
+         * Tables d'attaque des pièces glissantes (≈ 840 Ko), remplies une seule fois au démarrage
+         */
+        class SliderTables {
+        public:
+            static constexpr int ROOK_TABLE_SIZE = 0x19000;
+            static constexpr int BISHOP_TABLE_SIZE = 0x1480;
+
+            std::array<Magic, Bitboards::SQUARE_COUNT> rookMagics;
+            std::array<Magic, Bitboards::SQUARE_COUNT> bishopMagics;
+            std::array<Bitboard, ROOK_TABLE_SIZE> rookTable;
+            std::array<Bitboard, BISHOP_TABLE_SIZE> bishopTable;
+
+            SliderTables() {
+                initialize(rookTable.data(), rookMagics, ROOK_DIRECTIONS);
+                initialize(bishopTable.data(), bishopMagics, BISHOP_DIRECTIONS);
+            }
+
+        private:
+            static void initialize(Bitboard* table, std::array<Magic, Bitboards::SQUARE_COUNT>& magics,
+                                   const int (&directions)[4][2]) {
+                std::array<Bitboard, 4096> occupancies;
+                std::array<Bitboard, 4096> reference;
+#if !defined(CHESS_USE_PEXT)
+                // Graines par rangée connues pour converger rapidement
+                constexpr std::uint64_t SEEDS[ChessConstants::BOARD_SIZE] = {
+                    728, 10316, 55013, 32803, 12281, 15100, 16645, 255
+                };
+                std::array<int, 4096> epoch{};
+                int attempt = 0;
+#endif
+                Bitboard* next = table;
+
+                for (int square = 0; square < Bitboards::SQUARE_COUNT; ++square) {
+                    // Les bords ne changent jamais le résultat : ils sont exclus du masque
+                    Bitboard edges = ((Bitboards::RANK_1 | Bitboards::RANK_8) &
+                                      ~(Bitboards::RANK_1 << (8 * Bitboards::rankOf(square)))) |
+                                     ((Bitboards::FILE_A | Bitboards::FILE_H) &
+                                      ~(Bitboards::FILE_A << Bitboards::fileOf(square)));
+
+                    Magic& entry = magics[square];
+                    entry.mask = slidingAttacks(square, Bitboards::EMPTY, directions) & ~edges;
+                    entry.shift = static_cast<unsigned>(Bitboards::SQUARE_COUNT - Bitboards::popCount(entry.mask));
+                    entry.magic = 0;
+                    entry.attacks = next;
+
+                    // Énumère tous les sous-ensembles du masque (Carry-Rippler)
+                    int size = 0;
+                    Bitboard subset = Bitboards::EMPTY;
+                    do {
+                        occupancies[size] = subset;
+                        reference[size] = slidingAttacks(square, subset, directions);
+#if defined(CHESS_USE_PEXT)
+                        next[_pext_u64(subset, entry.mask)] = reference[size];
+#endif
+                        ++size;
+                        subset = (subset - entry.mask) & entry.mask;
+                    } while (subset);
+
+#if !defined(CHESS_USE_PEXT)
+                    MagicRandom random(SEEDS[Bitboards::rankOf(square)]);
+                    for (int i = 0; i < size;) {
+                        do {
+                            entry.magic = random.sparse();
+                        } while (Bitboards::popCount((entry.magic * entry.mask) >> 56) < 6);
+
+                        // Vérifie que les collisions éventuelles donnent la même attaque
+                        ++attempt;
+                        for (i = 0; i < size; ++i) {
+                            unsigned index = entry.index(occupancies[i]);
+                            if (epoch[index] < attempt) {
+                                epoch[index] = attempt;
+                                next[index] = reference[i];
+                            } else if (next[index] != reference[i]) {
+                                break;
+                            }
+                        }
+                    }
+#endif
+
+                    next += size;
+                }
+            }
+        };
+
+        inline const SliderTables SLIDERS;
+    }
+
+    /**
+     * Attaques d'une tour depuis une case pour une occupation donnée
+     */
+    inline Bitboard rookAttacks(int square, Bitboard occupancy) {
+        const detail::Magic& entry = detail::SLIDERS.rookMagics[square];
+        return entry.attacks[entry.index(occupancy)];
+    }
+
+    /**
+     * Attaques d'un fou depuis une case pour une occupation donnée
+     */
+    inline Bitboard bishopAttacks(int square, Bitboard occupancy) {
+        const detail::Magic& entry = detail::SLIDERS.bishopMagics[square];
+        return entry.attacks[entry.index(occupancy)];
+    }
+
+    inline Bitboard queenAttacks(int square, Bitboard occupancy) {
+        return rookAttacks(square, occupancy) | bishopAttacks(square, occupancy);
+    }
+
+    constexpr Bitboard knightAttacks(int square) { return detail::KNIGHT[square]; }
+    constexpr Bitboard kingAttacks(int square) { return detail::KING[square]; }
+
+    /**
+     * Cases attaquées (en diagonale) par un pion de la couleur donnée
+     */
+    constexpr Bitboard pawnAttacks(Color color, int square) {
+        return detail::PAWN[static_cast<int>(color)][square];
+    }
+
+    /**
+     * Cases strictement entre a et b si elles sont sur une même ligne, colonne ou diagonale
+     * Un chemin est libre si between(a, b) & occupation est vide.
+     */
+    constexpr Bitboard between(int a, int b) { return detail::BETWEEN[a][b]; }
+
+    /**
+     * Ligne entière passant par a et b (vide si elles ne sont pas alignées)
+     */
+    constexpr Bitboard line(int a, int b) { return detail::LINE[a][b]; }
+
+    constexpr bool aligned(int a, int b, int c) {
+        return Bitboards::contains(detail::LINE[a][b], c);
+    }
+
+    /**
+     * Attaques d'une pièce quelconque (hors pion) pour une occupation donnée
+     */
+    inline Bitboard pieceAttacks(PieceType type, int square, Bitboard occupancy) {
+        switch (type) {
+            case PieceType::ROOK:   return rookAttacks(square, occupancy);
+            case PieceType::BISHOP: return bishopAttacks(square, occupancy);
+            case PieceType::QUEEN:  return queenAttacks(square, occupancy);
+            case PieceType::KNIGHT: return knightAttacks(square);
+            case PieceType::KING:   return kingAttacks(square);
+            default:                return Bitboards::EMPTY;
+        }
+    }
+}
+
+#endif // ATTACKS_HPP
\ No newline at end of file
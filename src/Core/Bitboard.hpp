@@ -0,0 +1,91 @@
+#ifndef BITBOARD_HPP
+#define BITBOARD_HPP
+
+#include "../Utils/Constants.hpp"
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Ensemble de cases représenté par un masque de 64 bits
+ * Le bit n correspond à la case d'index n = y * 8 + x (a1 = 0, h1 = 7, h8 = 63)
+ */
+using Bitboard = std::uint64_t;
+
+namespace Bitboards {
+    constexpr int SQUARE_COUNT = ChessConstants::BOARD_SIZE * ChessConstants::BOARD_SIZE;
+    constexpr int NO_SQUARE = -1;
+
+    constexpr Bitboard EMPTY = 0ULL;
+    constexpr Bitboard FILE_A = 0x0101010101010101ULL;
+    constexpr Bitboard FILE_H = FILE_A << 7;
+    constexpr Bitboard RANK_1 = 0xFFULL;
+    constexpr Bitboard RANK_2 = RANK_1 << 8;
+    constexpr Bitboard RANK_3 = RANK_1 << 16;
+    constexpr Bitboard RANK_6 = RANK_1 << 40;
+    constexpr Bitboard RANK_7 = RANK_1 << 48;
+    constexpr Bitboard RANK_8 = RANK_1 << 56;
+
+    /**
+     * Conversions entre coordonnées (x, y) et index de case
+     */
+    constexpr int squareIndex(int x, int y) { return y * ChessConstants::BOARD_SIZE + x; }
+    constexpr int fileOf(int square) { return square & 7; }
+    constexpr int rankOf(int square) { return square >> 3; }
+
+    constexpr Bitboard squareBB(int square) { return 1ULL << square; }
+
+    constexpr bool contains(Bitboard bb, int square) {
+        return (bb & squareBB(square)) != 0;
+    }
+
+    /**
+     * Nombre de cases présentes dans le masque
+     */
+    inline int popCount(Bitboard bb) {
+#if defined(_MSC_VER)
+        return static_cast<int>(__popcnt64(bb));
+#else
+        return __builtin_popcountll(bb);
+#endif
+    }
+
+    /**
+     * Index de la case la plus basse du masque (le masque ne doit pas être vide)
+     */
+    inline int lsb(Bitboard bb) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, bb);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(bb);
+#endif
+    }
+
+    /**
+     * Index de la case la plus haute du masque (le masque ne doit pas être vide)
+     */
+    inline int msb(Bitboard bb) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, bb);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(bb);
+#endif
+    }
+
+    /**
+     * Retire la case la plus basse du masque et retourne son index
+     */
+    inline int popLsb(Bitboard& bb) {
+        int square = lsb(bb);
+        bb &= bb - 1;
+        return square;
+    }
+}
+
+#endif // BITBOARD_HPP
\ No newline at end of file
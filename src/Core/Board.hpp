@@ -1,54 +1,173 @@
 #ifndef BOARD_HPP
 #define BOARD_HPP
 
+#include "BoardState.hpp"
+#include "Bitboard.hpp"
+#include "Fen.hpp"
 #include "../Pieces/Piece.hpp"
+#include "../Pieces/Pawn.hpp"
+#include "../Pieces/Rook.hpp"
+#include "../Pieces/Knight.hpp"
+#include "../Pieces/Bishop.hpp"
+#include "../Pieces/Queen.hpp"
+#include "../Pieces/King.hpp"
 #include "../Utils/Position.hpp"
+#include "../Utils/Square.hpp"
 #include "../Utils/Move.hpp"
 #include "../Utils/Constants.hpp"
+#include <algorithm>
 #include <array>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
 
 
 class Board {
 
     private:
 
-    using BoardArray = std::array<std::array<std::unique_ptr<Piece>, ChessConstants::BOARD_SIZE>, ChessConstants::BOARD_SIZE>;
-    BoardArray board_;
-    
+    /**
+     * Storage for the Piece objects handed out by getPieceAt(). They are
+     * rebuilt lazily from the bitboards and never allocated on the heap.
+     */
+    using PieceSlot = std::variant<std::monostate, Pawn, Rook, Knight, Bishop, Queen, King>;
+
+    /**
+     * One entry of the undo stack: the move played and what it overwrote.
+     */
+    struct HistoryEntry {
+        EngineMove move;
+        UndoInfo undo;
+    };
+
+    BoardState state_;
+    std::vector<HistoryEntry> history_;
+    mutable std::array<PieceSlot, Bitboards::SQUARE_COUNT> pieceCache_;
+    mutable Bitboard cachedSquares_;
+
 public:
 
-    Board() {
-        clearBoard();
-    }
-    
+    Board() : cachedSquares_(Bitboards::EMPTY) {}
+
     ~Board() = default;
-    
-    Board(const Board& other) {
-        copyFrom(other);
-    }
-    
+
+    /**
+     * @brief Copy constructor for the Board class.
+     *
+     * The bitboard state and the undo history are copied; the Piece objects
+     * of the compatibility layer are rebuilt on demand instead of cloned.
+     *
+     * @param other The Board object to copy from
+     */
+    Board(const Board& other)
+        : state_(other.state_), history_(other.history_), cachedSquares_(Bitboards::EMPTY) {}
+
     /**
      * @brief Copy assignment operator for the Board class.
-     * 
+     *
      * Assigns the contents of another Board object to this Board instance.
-     * Uses the copy-and-swap idiom to ensure exception safety and handles
-     * self-assignment by checking if the objects are the same.
-     * 
+     * Handles self-assignment by checking if the objects are the same.
+     *
      * @param other The Board object to copy from
      * @return Board& A reference to this Board object after assignment
      */
     Board& operator=(const Board& other) {
         if (this != &other) {
-            copyFrom(other);
+            state_ = other.state_;
+            history_ = other.history_;
+            cachedSquares_ = Bitboards::EMPTY;
         }
         return *this;
     }
-    
+
+
+    /**
+     * @brief Gives read access to the underlying bitboard position.
+     *
+     * @return const BoardState& The trivially copyable position used by the engine
+     */
+    const BoardState& getState() const {
+        return state_;
+    }
+
+
+    /**
+     * @brief Replaces the whole position with the given bitboard state.
+     *
+     * The undo history is discarded.
+     *
+     * @param state The position to load
+     */
+    void setState(const BoardState& state) {
+        state_ = state;
+        history_.clear();
+        cachedSquares_ = Bitboards::EMPTY;
+    }
+
+
+    /**
+     * @brief Loads a position from a FEN string.
+     *
+     * The undo history is discarded.
+     *
+     * @param fen The position in Forsyth-Edwards Notation
+     * @throws std::invalid_argument if the string is not a valid FEN (the board is left unchanged)
+     */
+    void loadFen(std::string_view fen) {
+        setState(Fen::parse(fen));
+    }
+
+
+    /**
+     * @brief Returns the position in Forsyth-Edwards Notation.
+     */
+    std::string toFen() const {
+        return Fen::toString(state_);
+    }
+
+
+    /**
+     * @brief Sets the castling rights of the position.
+     *
+     * The rights also drive the "has moved" flag reported by the King and
+     * Rook objects returned from getPieceAt().
+     *
+     * @param rights Combination of the BoardState castling flags
+     */
+    void setCastlingRights(std::uint8_t rights) {
+        state_.setCastlingRights(rights);
+        cachedSquares_ = Bitboards::EMPTY;
+    }
+
+
+    /**
+     * @brief Sets the side to move stored in the position.
+     *
+     * @param color The color of the player to move
+     */
+    void setSideToMove(Color color) {
+        state_.setSideToMove(color);
+    }
+
+
+    /**
+     * @brief Sets the en passant target square (the square a pawn just skipped).
+     *
+     * @param square Square index, or Bitboards::NO_SQUARE when no capture is possible
+     */
+    void setEnPassantSquare(int square) {
+        state_.setEnPassantSquare(square);
+    }
+
 
     /**
      * @brief Retrieves the piece at the specified position on the board.
-     * 
+     *
+     * The returned object is a view of the bitboard state. It stays valid
+     * until the square is modified.
+     *
      * @param pos The position on the board to check for a piece
      * @return Piece* Pointer to the piece at the given position, or nullptr if the position is invalid or empty
      */
@@ -56,71 +175,110 @@ public:
         if (!pos.isValid()) {
             return nullptr;
         }
-        return board_[pos.getY()][pos.getX()].get();
+        int square = Bitboards::squareIndex(pos.getX(), pos.getY());
+        if (state_.isEmpty(square)) {
+            return nullptr;
+        }
+        if (!Bitboards::contains(cachedSquares_, square)) {
+            buildPiece(square);
+        }
+        return std::visit(SlotToPiece{}, pieceCache_[square]);
     }
-    
+
+
+    /**
+     * @brief Returns the one-byte code of the piece at a position.
+     *
+     * Unlike getPieceAt(), no Piece object is built.
+     *
+     * @param pos The position on the board to check
+     * @return PieceCode The piece, or PieceCode::none() if the square is empty
+     */
+    PieceCode getPieceCodeAt(const Position& pos) const {
+        return state_.pieceAt(Square::fromPosition(pos).index());
+    }
+
+
+    /**
+     * @brief Places a piece given by its one-byte code, without any allocation.
+     *
+     * @param pos The position where the piece should be placed
+     * @param piece The piece to place, or PieceCode::none() to empty the square
+     */
+    void setPieceAt(const Position& pos, PieceCode piece) {
+        int square = Square::fromPosition(pos).index();
+        if (piece.isNone()) {
+            state_.removePiece(square);
+        } else {
+            state_.putPiece(square, piece.getColor(), piece.getType());
+        }
+        cachedSquares_ &= ~Bitboards::squareBB(square);
+    }
+
 
     /**
      * @brief Sets a piece at the specified position on the board.
-     * 
-     * Places the given piece at the specified position if the position is valid.
-     * The piece ownership is transferred to the board through move semantics.
-     * If the position is invalid, no operation is performed.
-     * 
+     *
+     * Places a piece of the same type and color as the given one at the
+     * specified position if the position is valid. Only the type and color
+     * are kept; the object itself is released. A null pointer empties the square.
+     *
      * @param pos The position where the piece should be placed
      * @param piece Unique pointer to the piece to be placed (ownership transferred)
      */
     void setPieceAt(const Position& pos, std::unique_ptr<Piece> piece) {
-        if (pos.isValid()) {
-            board_[pos.getY()][pos.getX()] = std::move(piece);
+        if (!pos.isValid()) {
+            return;
         }
+        setPieceAt(pos, piece ? piece->getCode() : PieceCode::none());
     }
-    
 
-    
+
+
     /**
      * @brief Removes the piece at the specified position on the board.
-     * 
-     * This method removes a chess piece from the given position by resetting
-     * the corresponding cell on the board. The operation is only performed
+     *
+     * This method removes a chess piece from the given position by clearing
+     * the corresponding bit in the bitboards. The operation is only performed
      * if the provided position is valid.
-     * 
+     *
      * @param pos The position from which to remove the piece. Must be a valid
      *            board position (within board boundaries).
-     * 
+     *
      * @note If the position is invalid, no operation is performed.
      * @note If there is no piece at the specified position, the operation
      *       has no effect.
      */
     void removePieceAt(const Position& pos) {
         if (pos.isValid()) {
-            board_[pos.getY()][pos.getX()].reset();
+            int square = Bitboards::squareIndex(pos.getX(), pos.getY());
+            state_.removePiece(square);
+            cachedSquares_ &= ~Bitboards::squareBB(square);
         }
     }
-    
+
 
     /**
      * @brief Checks if a position on the board is empty (contains no piece).
-     * 
+     *
      * @param pos The position to check for emptiness
      * @return true if the position contains no piece, false otherwise
      */
     bool isEmpty(const Position& pos) const {
-        return getPieceAt(pos) == nullptr;
+        return !pos.isValid() || state_.isEmpty(Bitboards::squareIndex(pos.getX(), pos.getY()));
     }
-    
+
 
     /**
      * @brief Moves a piece from one position to another on the board.
-     * 
+     *
      * This method validates the move and transfers the piece from the source
-     * position to the destination position. The piece's internal position
-     * is updated to reflect the new location.
-     * 
+     * position to the destination position, replacing any piece standing there.
+     *
      * @param move The Move object containing source and destination positions
      * @return true if the piece was successfully moved, false if the move
      *         is invalid or no piece exists at the source position
-     * 
+     *
      * @note This method does not validate chess rules or check for piece
      *       movement legality - it only performs basic validation and transfer
      */
@@ -128,49 +286,155 @@ public:
         if (!move.isValid()) {
             return false;
         }
-        
-        Piece* piece = getPieceAt(move.getFrom());
-        if (!piece) {
+
+        std::uint8_t previousRights = state_.getCastlingRights();
+        int from = Bitboards::squareIndex(move.getFrom().getX(), move.getFrom().getY());
+        int to = Bitboards::squareIndex(move.getTo().getX(), move.getTo().getY());
+        if (!state_.movePiece(from, to)) {
             return false;
         }
-        
 
-        auto movedPiece = std::move(board_[move.getFrom().getY()][move.getFrom().getX()]);
-        board_[move.getTo().getY()][move.getTo().getX()] = std::move(movedPiece);
-        board_[move.getTo().getY()][move.getTo().getX()]->setPosition(move.getTo());
-        
+        if (state_.getCastlingRights() != previousRights) {
+            cachedSquares_ = Bitboards::EMPTY;
+        } else {
+            cachedSquares_ &= ~(Bitboards::squareBB(from) | Bitboards::squareBB(to));
+        }
+
         return true;
     }
-    
+
+
+    /**
+     * @brief Plays a move and pushes its undo record on the history stack.
+     *
+     * Unlike movePiece(), this applies the full chess semantics of the move:
+     * captures (en passant included), castling, promotion, castling rights,
+     * en passant square, clocks and side to move.
+     *
+     * @param move A legal move for the side to move (see MoveGenerator)
+     */
+    void makeMove(const EngineMove& move) {
+        HistoryEntry entry;
+        entry.move = move;
+        state_.makeMove(move, entry.undo);
+        history_.push_back(entry);
+        cachedSquares_ = Bitboards::EMPTY;
+    }
+
+
+    /**
+     * @brief Takes back the last move played with makeMove().
+     *
+     * @return false if there is no move to take back
+     */
+    bool unmakeMove() {
+        if (history_.empty()) {
+            return false;
+        }
+        const HistoryEntry& entry = history_.back();
+        state_.unmakeMove(entry.move, entry.undo);
+        history_.pop_back();
+        cachedSquares_ = Bitboards::EMPTY;
+        return true;
+    }
+
+
+    /**
+     * @brief Number of moves that can currently be taken back.
+     */
+    size_t getHistorySize() const {
+        return history_.size();
+    }
+
+
+    /**
+     * @brief Returns the last move played with makeMove(), or EngineMove::none().
+     */
+    EngineMove getLastMove() const {
+        return history_.empty() ? EngineMove::none() : history_.back().move;
+    }
+
+
+    /**
+     * @brief Returns the piece index captured by the last move, or BoardState::NO_PIECE.
+     */
+    int getLastCapturedPiece() const {
+        return history_.empty() ? BoardState::NO_PIECE : history_.back().undo.capturedPiece;
+    }
+
+
+    /**
+     * @brief Counts earlier occurrences of the current position in the history.
+     *
+     * Positions are compared by Zobrist key, only as far back as the last
+     * capture or pawn move (the halfmove clock) and only with the same side
+     * to move.
+     *
+     * @return Number of previous occurrences (2 means threefold repetition)
+     */
+    int getRepetitionCount() const {
+        int count = 0;
+        int size = static_cast<int>(history_.size());
+        int limit = state_.getHalfmoveClock();
+        for (int plies = 2; plies <= limit && plies <= size; plies += 2) {
+            if (history_[size - plies].undo.hash == state_.getHash()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+
+    /**
+     * @brief Zobrist keys of the positions that can still repeat, oldest first.
+     *
+     * Only the positions since the last capture or pawn move are returned, in
+     * the form expected by Search.
+     */
+    std::vector<Zobrist::Key> getRepetitionKeys() const {
+        int size = static_cast<int>(history_.size());
+        int first = std::max(0, size - state_.getHalfmoveClock());
+        std::vector<Zobrist::Key> keys;
+        keys.reserve(static_cast<size_t>(size - first));
+        for (int i = first; i < size; ++i) {
+            keys.push_back(history_[i].undo.hash);
+        }
+        return keys;
+    }
+
+
+    /**
+     * @brief Reserves room in the history so that long games do not reallocate.
+     */
+    void reserveHistory(size_t moves) {
+        history_.reserve(moves);
+    }
+
 
     /**
-     * @brief Clears the entire chess board by resetting all pieces to null.
-     * 
-     * This method iterates through all squares on the board and resets each
-     * piece pointer to nullptr, effectively removing all pieces from the board.
+     * @brief Clears the entire chess board.
+     *
      * After calling this method, the board will be empty and ready for a new
      * game setup or specific position arrangement.
      */
     void clearBoard() {
-        for (auto& row : board_) {
-            for (auto& piece : row) {
-                piece.reset();
-            }
-        }
+        state_.clear();
+        history_.clear();
+        cachedSquares_ = Bitboards::EMPTY;
     }
-    
+
     /**
      * @brief Checks if the path between two positions is clear of any pieces.
-     * 
+     *
      * This method checks all squares between the 'from' and 'to' positions
      * (exclusive) to determine if they are empty. It supports horizontal,
      * vertical, and diagonal paths. If the path is clear, it returns true;
      * otherwise, it returns false.
-     * 
+     *
      * @param from The starting position of the path
      * @param to The ending position of the path
      * @return true if the path is clear, false if any square along the path is occupied
-     * 
+     *
      * @note This method assumes that 'from' and 'to' are not the same position.
      * @note If 'from' and 'to' are not aligned horizontally, vertically, or diagonally,
      *       the method will return false as it does not handle non-linear paths.
@@ -179,50 +443,161 @@ public:
         if (from == to) {
             return true;
         }
-        
-        int deltaX = to.getX() - from.getX();
-        int deltaY = to.getY() - from.getY();
-        
-        int stepX = (deltaX > 0) ? 1 : (deltaX < 0) ? -1 : 0;
-        int stepY = (deltaY > 0) ? 1 : (deltaY < 0) ? -1 : 0;
-        
-        Position current(from.getX() + stepX, from.getY() + stepY);
-        
-        while (current != to) {
-            if (!isEmpty(current)) {
-                return false;
-            }
-            current.setPosition(current.getX() + stepX, current.getY() + stepY);
+
+        int a = Square::fromPosition(from).index();
+        int b = Square::fromPosition(to).index();
+        if (Attacks::line(a, b) == Bitboards::EMPTY) {
+            return false; // Cases non alignées
         }
-        
-        return true;
+
+        // Une seule intersection entre le rayon précalculé et l'occupation
+        return (Attacks::between(a, b) & state_.getOccupancy()) == Bitboards::EMPTY;
     }
-    
+
+    /**
+     * @brief Returns every piece (of both colors) attacking a position.
+     *
+     * @param pos The attacked position
+     * @return Bitboard Mask of the attacking pieces' squares
+     */
+    Bitboard getAttackers(const Position& pos) const {
+        return state_.attackersTo(Bitboards::squareIndex(pos.getX(), pos.getY()));
+    }
+
+
+    /**
+     * @brief Checks if a position is attacked by the opponents of a color.
+     *
+     * @param pos The position to test
+     * @param color The color of the defending side
+     * @return true if at least one enemy piece attacks the position
+     */
+    bool isSquareAttacked(const Position& pos, Color color) const {
+        return state_.isSquareAttackedBy(Bitboards::squareIndex(pos.getX(), pos.getY()),
+                                         oppositeColor(color));
+    }
+
+
+    /**
+     * @brief Checks if the king of the given color is in check.
+     *
+     * @param color The color of the king to test
+     * @return true if the king is attacked, false otherwise or if there is no king
+     */
+    bool isInCheck(Color color) const {
+        return state_.isInCheck(color);
+    }
+
+
+    /**
+     * @brief Returns the enemy pieces currently giving check to the side to move.
+     *
+     * @return Bitboard Mask of the checking pieces (empty when not in check)
+     */
+    Bitboard getCheckers() const {
+        return state_.getCheckers();
+    }
+
+
+    /**
+     * @brief Returns the pieces of a color that are pinned against their king.
+     *
+     * @param color The color whose pinned pieces are wanted
+     * @return Bitboard Mask of the pinned pieces
+     */
+    Bitboard getPinnedPieces(Color color) const {
+        return state_.getPinned(color);
+    }
+
 private:
+    struct SlotToPiece {
+        Piece* operator()(std::monostate&) const { return nullptr; }
+        Piece* operator()(Piece& piece) const { return &piece; }
+    };
+
     /**
-     * @brief Copies the contents from another board.
-     * 
-     * This method clears the current board and then copies the pieces
-     * from the 'other' board to the current board. It ensures that the
-     * current board is a deep copy of the 'other' board.
-     * @param other The board to copy from
-     * @note This method assumes that the 'other' board is valid and properly initialized.
-     * @note This method is used internally for copy construction and assignment.
-     * @see Board(const Board& other)
-     * @see Board& operator=(const Board& other)
-     * @private
-     * 
-     */
-    void copyFrom(const Board& other) {
-        clearBoard();
-        for (int y = 0; y < ChessConstants::BOARD_SIZE; ++y) {
-            for (int x = 0; x < ChessConstants::BOARD_SIZE; ++x) {
-                if (other.board_[y][x]) {
-                    board_[y][x] = other.board_[y][x]->clone();
-                }
-            }
+     * @brief Rebuilds the Piece object of a square from the bitboard state.
+     *
+     * The "has moved" flag is derived from the position: pawns off their
+     * starting rank, and kings or rooks without the matching castling right.
+     *
+     * @param square The square to rebuild (must be occupied)
+     */
+    void buildPiece(int square) const {
+        PieceCode piece = state_.pieceAt(square);
+        Color color = piece.getColor();
+        Position pos(Bitboards::fileOf(square), Bitboards::rankOf(square));
+        PieceSlot& slot = pieceCache_[square];
+        bool moved = false;
+
+        switch (piece.getType()) {
+            case PieceType::PAWN:
+                slot.emplace<Pawn>(pos, color);
+                moved = Bitboards::rankOf(square) != (color == Color::WHITE ? 1 : 6);
+                break;
+            case PieceType::ROOK:
+                slot.emplace<Rook>(pos, color);
+                moved = (BoardState::castlingMask(square) & state_.getCastlingRights()) ==
+                        state_.getCastlingRights();
+                break;
+            case PieceType::KNIGHT:
+                slot.emplace<Knight>(pos, color);
+                break;
+            case PieceType::BISHOP:
+                slot.emplace<Bishop>(pos, color);
+                break;
+            case PieceType::QUEEN:
+                slot.emplace<Queen>(pos, color);
+                break;
+            case PieceType::KING:
+                slot.emplace<King>(pos, color);
+                moved = !state_.hasCastlingRight(color == Color::WHITE
+                    ? (BoardState::WHITE_KING_SIDE | BoardState::WHITE_QUEEN_SIDE)
+                    : (BoardState::BLACK_KING_SIDE | BoardState::BLACK_QUEEN_SIDE));
+                break;
         }
+
+        std::visit(SlotToPiece{}, slot)->setMoved(moved);
+        cachedSquares_ |= Bitboards::squareBB(square);
     }
 };
 
+/**
+ * Vérifie si le roi peut effectuer un roque
+ * Définie ici car elle a besoin de la définition complète de Board
+ */
+inline bool King::canCastle(const Board& board, bool isKingSide) const {
+    if (hasMoved_) {
+        return false;
+    }
+    
+    if (board.isInCheck(color_)) {
+        return false;
+    }
+    
+    int rookX = isKingSide ? 7 : 0;
+    auto rook = board.getPieceAt(Position(rookX, position_.getY()));
+    if (!rook || rook->getType() != PieceType::ROOK || rook->hasMovedBefore()) {
+        return false;
+    }
+    
+    int startX = isKingSide ? position_.getX() + 1 : 1;
+    int endX = isKingSide ? 7 : position_.getX();
+    
+    for (int x = startX; x < endX; ++x) {
+        if (board.getPieceAt(Position(x, position_.getY()))) {
+            return false;
+        }
+        
+        if (x == position_.getX() + (isKingSide ? 1 : -1) || 
+            x == position_.getX() + (isKingSide ? 2 : -2)) {
+            if (board.isSquareAttacked(Position(x, position_.getY()), color_)) {
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
 #endif // BOARD_HPP
\ No newline at end of file
@@ -0,0 +1,564 @@
+#ifndef BOARD_STATE_HPP
+#define BOARD_STATE_HPP
+
+#include "Attacks.hpp"
+#include "Bitboard.hpp"
+#include "PieceCode.hpp"
+#include "PieceSquareTables.hpp"
+#include "Zobrist.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/PieceType.hpp"
+#include "../Utils/EngineMove.hpp"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Everything makeMove() overwrites and unmakeMove() needs back.
+ */
+struct UndoInfo {
+    Zobrist::Key hash;
+    std::int8_t capturedPiece;
+    std::uint8_t castlingRights;
+    std::int8_t enPassantSquare;
+    std::uint16_t halfmoveClock;
+};
+
+/**
+ * @brief Bitboard representation of a chess position.
+ *
+ * Holds one bitboard per (color, piece type) pair plus the occupancy of
+ * each color, a one-byte PieceCode per square for O(1) lookups, the side to move, castling rights, en passant
+ * square and move clocks. The class owns no heap memory and is trivially
+ * copyable, so engine code can copy positions freely.
+ *
+ * A Zobrist key of the whole position and a pawn-only key are updated
+ * incrementally by every modifier, as are the material + piece-square
+ * scores (middlegame and endgame) and the game phase used by the tapered
+ * evaluation. Compile with CHESS_DEBUG_HASH to check them against a full
+ * recomputation after each change.
+ */
+class BoardState {
+public:
+    static constexpr int PIECE_TYPE_COUNT = 6;
+    static constexpr int PIECE_COUNT = 2 * PIECE_TYPE_COUNT;
+    static constexpr int NO_PIECE = -1;
+
+    // Droits de roque (combinables)
+    static constexpr std::uint8_t NO_CASTLING = 0;
+    static constexpr std::uint8_t WHITE_KING_SIDE = 1;
+    static constexpr std::uint8_t WHITE_QUEEN_SIDE = 2;
+    static constexpr std::uint8_t BLACK_KING_SIDE = 4;
+    static constexpr std::uint8_t BLACK_QUEEN_SIDE = 8;
+    static constexpr std::uint8_t ALL_CASTLING = 15;
+
+private:
+    std::array<Bitboard, PIECE_COUNT> pieces_;
+    std::array<Bitboard, 2> occupancy_;
+    std::array<PieceCode, Bitboards::SQUARE_COUNT> mailbox_;
+    Color sideToMove_;
+    std::uint8_t castlingRights_;
+    std::int8_t enPassantSquare_;
+    std::uint16_t halfmoveClock_;
+    std::uint16_t fullmoveNumber_;
+    Zobrist::Key hash_;
+    Zobrist::Key pawnHash_;
+    std::int16_t mgScore_;
+    std::int16_t egScore_;
+    std::uint8_t phase_;
+
+public:
+    BoardState() {
+        clear();
+    }
+
+    /**
+     * @brief Returns the standard starting position.
+     */
+    static BoardState startingPosition() {
+        constexpr PieceType BACK_RANK[8] = {
+            PieceType::ROOK, PieceType::KNIGHT, PieceType::BISHOP, PieceType::QUEEN,
+            PieceType::KING, PieceType::BISHOP, PieceType::KNIGHT, PieceType::ROOK
+        };
+
+        BoardState state;
+        for (int x = 0; x < ChessConstants::BOARD_SIZE; ++x) {
+            state.putPiece(Bitboards::squareIndex(x, 0), Color::WHITE, BACK_RANK[x]);
+            state.putPiece(Bitboards::squareIndex(x, 1), Color::WHITE, PieceType::PAWN);
+            state.putPiece(Bitboards::squareIndex(x, 6), Color::BLACK, PieceType::PAWN);
+            state.putPiece(Bitboards::squareIndex(x, 7), Color::BLACK, BACK_RANK[x]);
+        }
+        state.setCastlingRights(ALL_CASTLING);
+        return state;
+    }
+
+    /**
+     * @brief Index of a (color, type) pair in the piece bitboard array.
+     */
+    static constexpr int pieceIndex(Color color, PieceType type) {
+        return static_cast<int>(color) * PIECE_TYPE_COUNT + static_cast<int>(type);
+    }
+
+    static constexpr Color colorOfIndex(int index) {
+        return index < PIECE_TYPE_COUNT ? Color::WHITE : Color::BLACK;
+    }
+
+    static constexpr PieceType typeOfIndex(int index) {
+        return static_cast<PieceType>(index % PIECE_TYPE_COUNT);
+    }
+
+    /**
+     * @brief Removes every piece and resets the game state fields.
+     */
+    void clear() {
+        pieces_.fill(Bitboards::EMPTY);
+        occupancy_.fill(Bitboards::EMPTY);
+        mailbox_.fill(PieceCode::none());
+        sideToMove_ = Color::WHITE;
+        castlingRights_ = NO_CASTLING;
+        enPassantSquare_ = Bitboards::NO_SQUARE;
+        halfmoveClock_ = 0;
+        fullmoveNumber_ = 1;
+        hash_ = 0;
+        pawnHash_ = 0;
+        mgScore_ = 0;
+        egScore_ = 0;
+        phase_ = 0;
+    }
+
+    // Accès aux bitboards
+    Bitboard getPieces(Color color, PieceType type) const { return pieces_[pieceIndex(color, type)]; }
+    Bitboard getPieces(PieceType type) const {
+        return getPieces(Color::WHITE, type) | getPieces(Color::BLACK, type);
+    }
+    Bitboard getOccupancy(Color color) const { return occupancy_[static_cast<int>(color)]; }
+    Bitboard getOccupancy() const { return occupancy_[0] | occupancy_[1]; }
+
+    bool isEmpty(int square) const {
+        return !Bitboards::contains(getOccupancy(), square);
+    }
+
+    /**
+     * @brief Returns the piece index standing on a square.
+     *
+     * @param square Square index (0..63)
+     * @return Index in [0, PIECE_COUNT) or NO_PIECE if the square is empty
+     */
+    int pieceIndexAt(int square) const {
+        return mailbox_[square].index();
+    }
+
+    /**
+     * @brief Returns the piece standing on a square (PieceCode::none() if empty).
+     */
+    PieceCode pieceAt(int square) const {
+        return mailbox_[square];
+    }
+
+    /**
+     * @brief Places a piece on a square, replacing whatever stood there.
+     */
+    void putPiece(int square, Color color, PieceType type) {
+        removePiece(square);
+        addPieceIndex(square, pieceIndex(color, type));
+        checkHash();
+    }
+
+    /**
+     * @brief Empties a square. Has no effect if the square is already empty.
+     */
+    void removePiece(int square) {
+        int index = pieceIndexAt(square);
+        if (index == NO_PIECE) {
+            return;
+        }
+        removePieceIndex(square, index);
+        checkHash();
+    }
+
+    /**
+     * @brief Moves the piece on 'from' to 'to', removing any piece on 'to'.
+     *
+     * Castling rights tied to either square are dropped, since a king or
+     * rook leaving (or being captured on) its home square loses the right.
+     *
+     * @return false if 'from' is empty
+     */
+    bool movePiece(int from, int to) {
+        int index = pieceIndexAt(from);
+        if (index == NO_PIECE) {
+            return false;
+        }
+        removePiece(to);
+        movePieceIndex(from, to, index);
+        setCastlingRights(castlingRights_ & castlingMask(from) & castlingMask(to));
+        checkHash();
+        return true;
+    }
+
+    /**
+     * @brief Pieces of both colors attacking a square, for a given occupancy.
+     *
+     * Passing a modified occupancy lets callers look through pieces that are
+     * about to move (x-rays) without playing the move.
+     */
+    Bitboard attackersTo(int square, Bitboard occupied) const {
+        Bitboard rooks = getPieces(PieceType::ROOK) | getPieces(PieceType::QUEEN);
+        Bitboard bishops = getPieces(PieceType::BISHOP) | getPieces(PieceType::QUEEN);
+
+        return (Attacks::pawnAttacks(Color::WHITE, square) & getPieces(Color::BLACK, PieceType::PAWN)) |
+               (Attacks::pawnAttacks(Color::BLACK, square) & getPieces(Color::WHITE, PieceType::PAWN)) |
+               (Attacks::knightAttacks(square) & getPieces(PieceType::KNIGHT)) |
+               (Attacks::kingAttacks(square) & getPieces(PieceType::KING)) |
+               (Attacks::rookAttacks(square, occupied) & rooks) |
+               (Attacks::bishopAttacks(square, occupied) & bishops);
+    }
+
+    Bitboard attackersTo(int square) const {
+        return attackersTo(square, getOccupancy());
+    }
+
+    /**
+     * @brief Checks whether any piece of 'attacker' attacks the square.
+     */
+    bool isSquareAttackedBy(int square, Color attacker) const {
+        return (attackersTo(square) & getOccupancy(attacker)) != 0;
+    }
+
+    /**
+     * @brief Square of the king of the given color, or NO_SQUARE if it is absent.
+     */
+    int getKingSquare(Color color) const {
+        Bitboard king = getPieces(color, PieceType::KING);
+        return king ? Bitboards::lsb(king) : Bitboards::NO_SQUARE;
+    }
+
+    /**
+     * @brief Enemy pieces giving check to the side to move.
+     */
+    Bitboard getCheckers() const {
+        int king = getKingSquare(sideToMove_);
+        if (king == Bitboards::NO_SQUARE) {
+            return Bitboards::EMPTY;
+        }
+        return attackersTo(king) & getOccupancy(oppositeColor(sideToMove_));
+    }
+
+    bool isInCheck(Color color) const {
+        int king = getKingSquare(color);
+        return king != Bitboards::NO_SQUARE && isSquareAttackedBy(king, oppositeColor(color));
+    }
+
+    /**
+     * @brief Pieces of 'color' pinned against their own king.
+     *
+     * A piece is pinned when it is the only piece standing between its king
+     * and an enemy slider on the same line.
+     */
+    Bitboard getPinned(Color color) const {
+        int king = getKingSquare(color);
+        if (king == Bitboards::NO_SQUARE) {
+            return Bitboards::EMPTY;
+        }
+
+        Color them = oppositeColor(color);
+        Bitboard rookLines = Attacks::rookAttacks(king, Bitboards::EMPTY);
+        Bitboard bishopLines = Attacks::bishopAttacks(king, Bitboards::EMPTY);
+        Bitboard snipers = (rookLines & (getPieces(them, PieceType::ROOK) | getPieces(them, PieceType::QUEEN))) |
+                           (bishopLines & (getPieces(them, PieceType::BISHOP) | getPieces(them, PieceType::QUEEN)));
+        Bitboard occupied = getOccupancy();
+        Bitboard pinned = Bitboards::EMPTY;
+
+        while (snipers) {
+            Bitboard blockers = Attacks::between(king, Bitboards::popLsb(snipers)) & occupied;
+            if (blockers && !(blockers & (blockers - 1))) {
+                pinned |= blockers & getOccupancy(color);
+            }
+        }
+        return pinned;
+    }
+
+    /**
+     * @brief Plays a move in place and records what is needed to undo it.
+     *
+     * The move must be pseudo-legal for the side to move. Handles captures,
+     * en passant, castling (the rook follows the king) and promotions, and
+     * updates castling rights, en passant square and move clocks.
+     *
+     * @param move The move to play
+     * @param undo Receives the state to hand back to unmakeMove()
+     */
+    void makeMove(const EngineMove& move, UndoInfo& undo) {
+        Color us = sideToMove_;
+        int from = move.getFrom();
+        int to = move.getTo();
+        int moving = pieceIndexAt(from);
+        int capturedSquare = move.isEnPassant() ? (to ^ 8) : to;
+        int captured = move.isCastling() ? NO_PIECE : pieceIndexAt(capturedSquare);
+
+        undo.hash = hash_;
+        undo.capturedPiece = static_cast<std::int8_t>(captured);
+        undo.castlingRights = castlingRights_;
+        undo.enPassantSquare = enPassantSquare_;
+        undo.halfmoveClock = halfmoveClock_;
+
+        if (captured != NO_PIECE) {
+            removePieceIndex(capturedSquare, captured);
+        }
+        movePieceIndex(from, to, moving);
+
+        if (move.isPromotion()) {
+            removePieceIndex(to, moving);
+            addPieceIndex(to, pieceIndex(us, move.getPromotion()));
+        } else if (move.isCastling()) {
+            bool kingSide = to > from;
+            int rook = pieceIndex(us, PieceType::ROOK);
+            movePieceIndex(kingSide ? from + 3 : from - 4, kingSide ? from + 1 : from - 1, rook);
+        }
+
+        setCastlingRights(castlingRights_ & castlingMask(from) & castlingMask(to));
+
+        // La case en passant n'est retenue que si un pion adverse peut réellement y capturer
+        setEnPassantSquare(Bitboards::NO_SQUARE);
+        bool pawnMove = typeOfIndex(moving) == PieceType::PAWN;
+        if (pawnMove && (to ^ from) == 16) {
+            int skipped = (from + to) / 2;
+            if (Attacks::pawnAttacks(us, skipped) & getPieces(oppositeColor(us), PieceType::PAWN)) {
+                setEnPassantSquare(skipped);
+            }
+        }
+
+        halfmoveClock_ = (pawnMove || captured != NO_PIECE) ? 0 : halfmoveClock_ + 1;
+        if (us == Color::BLACK) {
+            ++fullmoveNumber_;
+        }
+        setSideToMove(oppositeColor(us));
+        checkHash();
+    }
+
+    /**
+     * @brief Takes back a move played with makeMove().
+     *
+     * @param move The move that was played
+     * @param undo The record filled by makeMove()
+     */
+    void unmakeMove(const EngineMove& move, const UndoInfo& undo) {
+        sideToMove_ = oppositeColor(sideToMove_);
+        Color us = sideToMove_;
+        if (us == Color::BLACK) {
+            --fullmoveNumber_;
+        }
+
+        int from = move.getFrom();
+        int to = move.getTo();
+
+        if (move.isPromotion()) {
+            removePieceIndex(to, pieceIndex(us, move.getPromotion()));
+            addPieceIndex(to, pieceIndex(us, PieceType::PAWN));
+        } else if (move.isCastling()) {
+            bool kingSide = to > from;
+            int rook = pieceIndex(us, PieceType::ROOK);
+            movePieceIndex(kingSide ? from + 1 : from - 1, kingSide ? from + 3 : from - 4, rook);
+        }
+
+        movePieceIndex(to, from, pieceIndexAt(to));
+
+        if (undo.capturedPiece != NO_PIECE) {
+            addPieceIndex(move.isEnPassant() ? (to ^ 8) : to, undo.capturedPiece);
+        }
+
+        castlingRights_ = undo.castlingRights;
+        enPassantSquare_ = undo.enPassantSquare;
+        halfmoveClock_ = undo.halfmoveClock;
+        hash_ = undo.hash;
+        checkHash();
+    }
+
+    // État de la partie
+    Color getSideToMove() const { return sideToMove_; }
+    void setSideToMove(Color color) {
+        if (color != sideToMove_) {
+            hash_ ^= Zobrist::blackToMove();
+            sideToMove_ = color;
+        }
+    }
+
+    std::uint8_t getCastlingRights() const { return castlingRights_; }
+    void setCastlingRights(std::uint8_t rights) {
+        rights &= ALL_CASTLING;
+        hash_ ^= Zobrist::castling(castlingRights_) ^ Zobrist::castling(rights);
+        castlingRights_ = rights;
+    }
+    bool hasCastlingRight(std::uint8_t right) const { return (castlingRights_ & right) != 0; }
+
+    int getEnPassantSquare() const { return enPassantSquare_; }
+    void setEnPassantSquare(int square) {
+        if (enPassantSquare_ != Bitboards::NO_SQUARE) {
+            hash_ ^= Zobrist::enPassantFile(Bitboards::fileOf(enPassantSquare_));
+        }
+        if (square != Bitboards::NO_SQUARE) {
+            hash_ ^= Zobrist::enPassantFile(Bitboards::fileOf(square));
+        }
+        enPassantSquare_ = static_cast<std::int8_t>(square);
+    }
+
+    int getHalfmoveClock() const { return halfmoveClock_; }
+    void setHalfmoveClock(int clock) { halfmoveClock_ = static_cast<std::uint16_t>(clock); }
+
+    int getFullmoveNumber() const { return fullmoveNumber_; }
+    void setFullmoveNumber(int number) { fullmoveNumber_ = static_cast<std::uint16_t>(number); }
+
+    // Clés de Zobrist (mises à jour incrémentalement)
+    Zobrist::Key getHash() const { return hash_; }
+    Zobrist::Key getPawnHash() const { return pawnHash_; }
+
+    /**
+     * @brief Computes the Zobrist key of the position from scratch.
+     */
+    Zobrist::Key computeHash() const {
+        Zobrist::Key key = Zobrist::castling(castlingRights_);
+        for (int index = 0; index < PIECE_COUNT; ++index) {
+            Bitboard bb = pieces_[index];
+            while (bb) {
+                key ^= Zobrist::piece(index, Bitboards::popLsb(bb));
+            }
+        }
+        if (enPassantSquare_ != Bitboards::NO_SQUARE) {
+            key ^= Zobrist::enPassantFile(Bitboards::fileOf(enPassantSquare_));
+        }
+        if (sideToMove_ == Color::BLACK) {
+            key ^= Zobrist::blackToMove();
+        }
+        return key;
+    }
+
+    /**
+     * @brief Computes the pawn-only Zobrist key from scratch.
+     */
+    Zobrist::Key computePawnHash() const {
+        Zobrist::Key key = 0;
+        for (Color color : {Color::WHITE, Color::BLACK}) {
+            int index = pieceIndex(color, PieceType::PAWN);
+            Bitboard bb = pieces_[index];
+            while (bb) {
+                key ^= Zobrist::piece(index, Bitboards::popLsb(bb));
+            }
+        }
+        return key;
+    }
+
+    // Évaluation incrémentale (matériel + tables pièce-case), du point de vue des blancs
+    int getMidgameScore() const { return mgScore_; }
+    int getEndgameScore() const { return egScore_; }
+    int getPhase() const { return phase_; }
+
+    /**
+     * @brief Material + piece-square score from White's point of view, tapered by game phase.
+     */
+    int getTaperedScore() const {
+        return PieceSquare::taper(mgScore_, egScore_, phase_);
+    }
+
+    /**
+     * @brief Recomputes the middlegame and endgame scores and the phase from scratch.
+     */
+    void computeScores(int& mg, int& eg, int& phase) const {
+        mg = 0;
+        eg = 0;
+        phase = 0;
+        for (int index = 0; index < PIECE_COUNT; ++index) {
+            Bitboard bb = pieces_[index];
+            while (bb) {
+                PieceSquare::Score score = PieceSquare::value(index, Bitboards::popLsb(bb));
+                mg += score.mg;
+                eg += score.eg;
+                phase += PieceSquare::phase(index);
+            }
+        }
+    }
+
+private:
+    void addPieceIndex(int square, int index) {
+        Bitboard bb = Bitboards::squareBB(square);
+        pieces_[index] |= bb;
+        occupancy_[static_cast<int>(colorOfIndex(index))] |= bb;
+        mailbox_[square] = PieceCode::fromIndex(index);
+        togglePieceKey(index, square);
+        PieceSquare::Score score = PieceSquare::value(index, square);
+        mgScore_ = static_cast<std::int16_t>(mgScore_ + score.mg);
+        egScore_ = static_cast<std::int16_t>(egScore_ + score.eg);
+        phase_ = static_cast<std::uint8_t>(phase_ + PieceSquare::phase(index));
+    }
+
+    void removePieceIndex(int square, int index) {
+        Bitboard bb = Bitboards::squareBB(square);
+        pieces_[index] &= ~bb;
+        occupancy_[static_cast<int>(colorOfIndex(index))] &= ~bb;
+        mailbox_[square] = PieceCode::none();
+        togglePieceKey(index, square);
+        PieceSquare::Score score = PieceSquare::value(index, square);
+        mgScore_ = static_cast<std::int16_t>(mgScore_ - score.mg);
+        egScore_ = static_cast<std::int16_t>(egScore_ - score.eg);
+        phase_ = static_cast<std::uint8_t>(phase_ - PieceSquare::phase(index));
+    }
+
+    void movePieceIndex(int from, int to, int index) {
+        Bitboard fromTo = Bitboards::squareBB(from) | Bitboards::squareBB(to);
+        pieces_[index] ^= fromTo;
+        occupancy_[static_cast<int>(colorOfIndex(index))] ^= fromTo;
+        mailbox_[to] = mailbox_[from];
+        mailbox_[from] = PieceCode::none();
+        togglePieceKey(index, from);
+        togglePieceKey(index, to);
+        PieceSquare::Score before = PieceSquare::value(index, from);
+        PieceSquare::Score after = PieceSquare::value(index, to);
+        mgScore_ = static_cast<std::int16_t>(mgScore_ + after.mg - before.mg);
+        egScore_ = static_cast<std::int16_t>(egScore_ + after.eg - before.eg);
+    }
+
+    void togglePieceKey(int index, int square) {
+        Zobrist::Key key = Zobrist::piece(index, square);
+        hash_ ^= key;
+        if (typeOfIndex(index) == PieceType::PAWN) {
+            pawnHash_ ^= key;
+        }
+    }
+
+    /**
+     * Mode debug : compare les clés et les scores incrémentaux à un recalcul complet
+     */
+    void checkHash() const {
+#if defined(CHESS_DEBUG_HASH)
+        if (hash_ != computeHash() || pawnHash_ != computePawnHash()) {
+            throw std::logic_error("Clé de Zobrist incrémentale incohérente");
+        }
+        int mg, eg, phase;
+        computeScores(mg, eg, phase);
+        if (mg != mgScore_ || eg != egScore_ || phase != phase_) {
+            throw std::logic_error("Évaluation incrémentale incohérente");
+        }
+#endif
+    }
+
+public:
+    /**
+     * @brief Castling rights kept when a piece leaves or lands on a square.
+     */
+    static constexpr std::uint8_t castlingMask(int square) {
+        switch (square) {
+            case 0:  return ALL_CASTLING & ~WHITE_QUEEN_SIDE;                      // a1
+            case 4:  return ALL_CASTLING & ~(WHITE_KING_SIDE | WHITE_QUEEN_SIDE);  // e1
+            case 7:  return ALL_CASTLING & ~WHITE_KING_SIDE;                       // h1
+            case 56: return ALL_CASTLING & ~BLACK_QUEEN_SIDE;                      // a8
+            case 60: return ALL_CASTLING & ~(BLACK_KING_SIDE | BLACK_QUEEN_SIDE);  // e8
+            case 63: return ALL_CASTLING & ~BLACK_KING_SIDE;                       // h8
+            default: return ALL_CASTLING;
+        }
+    }
+};
+
+static_assert(std::is_trivially_copyable<BoardState>::value,
+              "BoardState must stay trivially copyable");
+
+#endif // BOARD_STATE_HPP
\ No newline at end of file
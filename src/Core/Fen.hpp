@@ -0,0 +1,279 @@
+#ifndef FEN_HPP
+#define FEN_HPP
+
+#include "Attacks.hpp"
+#include "Bitboard.hpp"
+#include "BoardState.hpp"
+#include "PieceCode.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/PieceType.hpp"
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * Lecture et écriture de positions en notation FEN
+ * (placement, trait, droits de roque, en passant, demi-coups, numéro du coup)
+ *
+ * Les deux compteurs finaux sont facultatifs, et ce qui suit les quatre premiers
+ * champs n'est pas lu s'il n'est pas numérique : les lignes EPD sont acceptées.
+ */
+class Fen {
+public:
+    static constexpr const char* STARTING_POSITION = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+    /**
+     * Lit une position FEN
+     * @throws std::invalid_argument si la chaîne n'est pas une FEN valide
+     */
+    static BoardState parse(std::string_view fen) {
+        BoardState state;
+        const char* error = read(fen, state);
+        if (error) {
+            throw std::invalid_argument(std::string("FEN invalide : ") + error);
+        }
+        return state;
+    }
+
+    /**
+     * Lit une position FEN sans exception ni allocation (chargement en masse)
+     * @param fen La chaîne FEN
+     * @param state Reçoit la position (indéfinie en cas d'erreur)
+     * @return nullptr en cas de succès, sinon la description de l'erreur
+     */
+    static const char* read(std::string_view fen, BoardState& state) noexcept {
+        state.clear();
+        size_t pos = 0;
+
+        // 1. Placement des pièces, de la 8e rangée à la 1re
+        std::string_view placement = nextField(fen, pos);
+        int x = 0;
+        int y = 7;
+        for (char c : placement) {
+            if (c == '/') {
+                if (x != 8 || y == 0) {
+                    return "rangée de longueur incorrecte";
+                }
+                x = 0;
+                --y;
+            } else if (c >= '1' && c <= '8') {
+                x += c - '0';
+                if (x > 8) {
+                    return "rangée de longueur incorrecte";
+                }
+            } else {
+                PieceCode piece = pieceFromChar(c);
+                if (piece.isNone()) {
+                    return "pièce inconnue";
+                }
+                if (x > 7) {
+                    return "rangée de longueur incorrecte";
+                }
+                state.putPiece(Bitboards::squareIndex(x, y), piece.getColor(), piece.getType());
+                ++x;
+            }
+        }
+        if (x != 8 || y != 0) {
+            return "placement incomplet";
+        }
+        if (Bitboards::popCount(state.getPieces(Color::WHITE, PieceType::KING)) != 1 ||
+            Bitboards::popCount(state.getPieces(Color::BLACK, PieceType::KING)) != 1) {
+            return "il faut exactement un roi par camp";
+        }
+
+        // 2. Trait
+        std::string_view side = nextField(fen, pos);
+        if (side == "w") {
+            state.setSideToMove(Color::WHITE);
+        } else if (side == "b") {
+            state.setSideToMove(Color::BLACK);
+        } else {
+            return "trait invalide";
+        }
+
+        // 3. Droits de roque (ceux dont le roi ou la tour a quitté sa case sont ignorés)
+        std::string_view castling = nextField(fen, pos);
+        std::uint8_t rights = BoardState::NO_CASTLING;
+        if (castling != "-") {
+            for (char c : castling) {
+                switch (c) {
+                    case 'K': rights |= BoardState::WHITE_KING_SIDE; break;
+                    case 'Q': rights |= BoardState::WHITE_QUEEN_SIDE; break;
+                    case 'k': rights |= BoardState::BLACK_KING_SIDE; break;
+                    case 'q': rights |= BoardState::BLACK_QUEEN_SIDE; break;
+                    default: return "droits de roque invalides";
+                }
+            }
+        }
+        state.setCastlingRights(rights & consistentCastlingRights(state));
+
+        // 4. En passant : la case doit suivre une double poussée adverse, mais elle n'est
+        //    retenue que si un pion peut réellement prendre (comme BoardState::makeMove)
+        std::string_view enPassant = nextField(fen, pos);
+        if (enPassant != "-") {
+            Color us = state.getSideToMove();
+            char rank = us == Color::WHITE ? '6' : '3';
+            if (enPassant.size() != 2 || enPassant[0] < 'a' || enPassant[0] > 'h' || enPassant[1] != rank) {
+                return "case en passant invalide";
+            }
+            int square = Bitboards::squareIndex(enPassant[0] - 'a', enPassant[1] - '1');
+            int pushed = us == Color::WHITE ? square - 8 : square + 8;   // Pion qui vient d'avancer de deux cases
+            int origin = us == Color::WHITE ? square + 8 : square - 8;   // Case qu'il a quittée
+            if (!Bitboards::contains(state.getPieces(oppositeColor(us), PieceType::PAWN), pushed) ||
+                !state.isEmpty(square) || !state.isEmpty(origin)) {
+                return "case en passant invalide";
+            }
+            if (Attacks::pawnAttacks(oppositeColor(us), square) & state.getPieces(us, PieceType::PAWN)) {
+                state.setEnPassantSquare(square);
+            }
+        }
+
+        // 5 et 6. Compteurs facultatifs
+        int halfmove = 0;
+        int fullmove = 1;
+        std::string_view field = nextField(fen, pos);
+        if (parseNumber(field, halfmove)) {
+            field = nextField(fen, pos);
+            if (parseNumber(field, fullmove) && fullmove < 1) {
+                fullmove = 1;
+            }
+        }
+        if (halfmove > MAX_COUNTER || fullmove > MAX_COUNTER) {
+            return "compteur hors limites";
+        }
+        state.setHalfmoveClock(halfmove);
+        state.setFullmoveNumber(fullmove);
+
+        return nullptr;
+    }
+
+    /**
+     * Écrit la position en FEN
+     * La case en passant n'apparaît que si une prise est possible.
+     */
+    static std::string toString(const BoardState& state) {
+        std::string fen;
+        fen.reserve(90);
+
+        for (int y = 7; y >= 0; --y) {
+            int empty = 0;
+            for (int x = 0; x < 8; ++x) {
+                PieceCode piece = state.pieceAt(Bitboards::squareIndex(x, y));
+                if (piece.isNone()) {
+                    ++empty;
+                    continue;
+                }
+                if (empty > 0) {
+                    fen += static_cast<char>('0' + empty);
+                    empty = 0;
+                }
+                fen += piece.toChar();
+            }
+            if (empty > 0) {
+                fen += static_cast<char>('0' + empty);
+            }
+            if (y > 0) {
+                fen += '/';
+            }
+        }
+
+        fen += state.getSideToMove() == Color::WHITE ? " w " : " b ";
+
+        if (state.getCastlingRights() == BoardState::NO_CASTLING) {
+            fen += '-';
+        } else {
+            if (state.hasCastlingRight(BoardState::WHITE_KING_SIDE))  fen += 'K';
+            if (state.hasCastlingRight(BoardState::WHITE_QUEEN_SIDE)) fen += 'Q';
+            if (state.hasCastlingRight(BoardState::BLACK_KING_SIDE))  fen += 'k';
+            if (state.hasCastlingRight(BoardState::BLACK_QUEEN_SIDE)) fen += 'q';
+        }
+
+        fen += ' ';
+        int enPassant = state.getEnPassantSquare();
+        if (enPassant == Bitboards::NO_SQUARE) {
+            fen += '-';
+        } else {
+            fen += static_cast<char>('a' + Bitboards::fileOf(enPassant));
+            fen += static_cast<char>('1' + Bitboards::rankOf(enPassant));
+        }
+
+        fen += ' ';
+        fen += std::to_string(state.getHalfmoveClock());
+        fen += ' ';
+        fen += std::to_string(state.getFullmoveNumber());
+        return fen;
+    }
+
+private:
+    // Les deux compteurs sont stockés sur 16 bits dans BoardState
+    static constexpr int MAX_COUNTER = 0xFFFF;
+
+    /**
+     * Champ suivant (séparé par des espaces), vide en fin de chaîne
+     */
+    static std::string_view nextField(std::string_view text, size_t& pos) noexcept {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) {
+            ++pos;
+        }
+        size_t start = pos;
+        while (pos < text.size() && text[pos] != ' ' && text[pos] != '\t' &&
+               text[pos] != '\r' && text[pos] != '\n') {
+            ++pos;
+        }
+        return text.substr(start, pos - start);
+    }
+
+    /**
+     * Entier décimal positif, arrêté dès qu'il dépasse MAX_COUNTER (pas de débordement)
+     * @return false si le champ n'est pas numérique
+     */
+    static bool parseNumber(std::string_view field, int& value) noexcept {
+        if (field.empty()) {
+            return false;
+        }
+        int result = 0;
+        for (char c : field) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            if (result <= MAX_COUNTER) {
+                result = result * 10 + (c - '0');
+            }
+        }
+        value = result;
+        return true;
+    }
+
+    static PieceCode pieceFromChar(char c) noexcept {
+        Color color = (c >= 'a' && c <= 'z') ? Color::BLACK : Color::WHITE;
+        switch (c | 0x20) {
+            case 'p': return PieceCode(color, PieceType::PAWN);
+            case 'n': return PieceCode(color, PieceType::KNIGHT);
+            case 'b': return PieceCode(color, PieceType::BISHOP);
+            case 'r': return PieceCode(color, PieceType::ROOK);
+            case 'q': return PieceCode(color, PieceType::QUEEN);
+            case 'k': return PieceCode(color, PieceType::KING);
+            default:  return PieceCode::none();
+        }
+    }
+
+    /**
+     * Droits de roque compatibles avec le placement (roi et tour sur leurs cases d'origine)
+     */
+    static std::uint8_t consistentCastlingRights(const BoardState& state) noexcept {
+        std::uint8_t rights = BoardState::NO_CASTLING;
+        Bitboard whiteRooks = state.getPieces(Color::WHITE, PieceType::ROOK);
+        Bitboard blackRooks = state.getPieces(Color::BLACK, PieceType::ROOK);
+        if (Bitboards::contains(state.getPieces(Color::WHITE, PieceType::KING), 4)) {
+            if (Bitboards::contains(whiteRooks, 7)) rights |= BoardState::WHITE_KING_SIDE;
+            if (Bitboards::contains(whiteRooks, 0)) rights |= BoardState::WHITE_QUEEN_SIDE;
+        }
+        if (Bitboards::contains(state.getPieces(Color::BLACK, PieceType::KING), 60)) {
+            if (Bitboards::contains(blackRooks, 63)) rights |= BoardState::BLACK_KING_SIDE;
+            if (Bitboards::contains(blackRooks, 56)) rights |= BoardState::BLACK_QUEEN_SIDE;
+        }
+        return rights;
+    }
+};
+
+#endif // FEN_HPP
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "Board.hpp"
 #include "MoveValidator.hpp"
+#include "MoveGenerator.hpp"
+#include "Notation.hpp"
 #include "../Players/Player.hpp"
 #include "../Pieces/Pawn.hpp"
 #include "../Pieces/Rook.hpp"
@@ -13,7 +15,10 @@
 #include "../UI/BoardRenderer.hpp"
 #include "../Enums/GameState.hpp"
 #include "../Utils/Move.hpp"
+#include "../Utils/MoveList.hpp"
 #include <memory>
+#include <string>
+#include <string_view>
 
 /**
  * Classe principale du jeu d'échecs
@@ -48,108 +53,143 @@ public:
     
     /**
      * Initialise le plateau avec la position de départ
+     * Aucune allocation : la position est copiée depuis BoardState::startingPosition()
      */
     void initializeBoard() {
-        board_.clearBoard();
-        
-        // Pièces blanches (rangée 0)
-        board_.setPieceAt(Position(0, 0), std::make_unique<Rook>(Position(0, 0), Color::WHITE));
-        board_.setPieceAt(Position(1, 0), std::make_unique<Knight>(Position(1, 0), Color::WHITE));
-        board_.setPieceAt(Position(2, 0), std::make_unique<Bishop>(Position(2, 0), Color::WHITE));
-        board_.setPieceAt(Position(3, 0), std::make_unique<Queen>(Position(3, 0), Color::WHITE));
-        board_.setPieceAt(Position(4, 0), std::make_unique<King>(Position(4, 0), Color::WHITE));
-        board_.setPieceAt(Position(5, 0), std::make_unique<Bishop>(Position(5, 0), Color::WHITE));
-        board_.setPieceAt(Position(6, 0), std::make_unique<Knight>(Position(6, 0), Color::WHITE));
-        board_.setPieceAt(Position(7, 0), std::make_unique<Rook>(Position(7, 0), Color::WHITE));
-        
-        // Pions blancs (rangée 1)
-        for (int x = 0; x < ChessConstants::BOARD_SIZE; ++x) {
-            board_.setPieceAt(Position(x, 1), std::make_unique<Pawn>(Position(x, 1), Color::WHITE));
-        }
-        
-        // Pions noirs (rangée 6)
-        for (int x = 0; x < ChessConstants::BOARD_SIZE; ++x) {
-            board_.setPieceAt(Position(x, 6), std::make_unique<Pawn>(Position(x, 6), Color::BLACK));
-        }
-        
-        // Pièces noires (rangée 7)
-        board_.setPieceAt(Position(0, 7), std::make_unique<Rook>(Position(0, 7), Color::BLACK));
-        board_.setPieceAt(Position(1, 7), std::make_unique<Knight>(Position(1, 7), Color::BLACK));
-        board_.setPieceAt(Position(2, 7), std::make_unique<Bishop>(Position(2, 7), Color::BLACK));
-        board_.setPieceAt(Position(3, 7), std::make_unique<Queen>(Position(3, 7), Color::BLACK));
-        board_.setPieceAt(Position(4, 7), std::make_unique<King>(Position(4, 7), Color::BLACK));
-        board_.setPieceAt(Position(5, 7), std::make_unique<Bishop>(Position(5, 7), Color::BLACK));
-        board_.setPieceAt(Position(6, 7), std::make_unique<Knight>(Position(6, 7), Color::BLACK));
-        board_.setPieceAt(Position(7, 7), std::make_unique<Rook>(Position(7, 7), Color::BLACK));
+        board_.setState(BoardState::startingPosition());
+    }
+    
+    /**
+     * Charge une position FEN (trait, roques, en passant et compteurs compris)
+     * Les scores des joueurs et l'historique sont remis à zéro.
+     * @throws std::invalid_argument si la FEN est invalide (la partie n'est pas modifiée)
+     */
+    void loadFen(std::string_view fen) {
+        board_.loadFen(fen);
+        whitePlayer_->clearCapturedPieces();
+        blackPlayer_->clearCapturedPieces();
+        currentPlayer_ = board_.getState().getSideToMove() == Color::WHITE ? whitePlayer_.get() : blackPlayer_.get();
+        lastMove_ = Move(Position(0, 0), Position(0, 0));
+        updateEnPassantState();
+        updateGameState();
+    }
+    
+    /**
+     * Retourne la position courante en FEN
+     */
+    std::string toFen() const {
+        return board_.toFen();
     }
     
     /**
      * Tente de faire un mouvement
+     * Le mouvement doit figurer parmi les coups légaux ; une promotion se fait en dame.
      */
     bool makeMove(const Move& move) {
-        if (gameState_ != GameState::PLAYING) {
+        EngineMove engineMove;
+        if (!findLegalMove(move, engineMove)) {
             return false;
         }
-        
-        // Vérification de sécurité supplémentaire : le joueur ne peut déplacer que ses propres pièces
-        Piece* pieceToMove = board_.getPieceAt(move.getFrom());
-        if (!pieceToMove) {
-            return false; // Aucune pièce à déplacer
-        }
-        
-        if (pieceToMove->getColor() != currentPlayer_->getColor()) {
-            return false; // Le joueur essaie de déplacer une pièce adverse !
-        }
-        
-        // Vérification spéciale pour l'en passant
-        bool isEnPassantMove = false;
-        Position enPassantCapturePos(0, 0);
-        
-        if (pieceToMove->getType() == PieceType::PAWN && enPassantAvailable_) {
-            Pawn* pawn = static_cast<Pawn*>(pieceToMove);
-            if (pawn->canCaptureEnPassant(move.getTo(), enPassantTarget_)) {
-                isEnPassantMove = true;
-                enPassantCapturePos = enPassantTarget_;
-            }
-        }
-        
-        if (!isEnPassantMove && !MoveValidator::isValidMove(board_, move, currentPlayer_->getColor())) {
+        return makeMove(engineMove);
+    }
+    
+    /**
+     * Tente de jouer un coup du moteur (issu de parseMove ou de la liste des coups légaux)
+     */
+    bool makeMove(const EngineMove& engineMove) {
+        if (isGameOver() || !isLegalMove(engineMove)) {
             return false;
         }
         
-        // Gestion de la capture
-        Piece* capturedPiece = nullptr;
+        // Effectue le mouvement
+        board_.makeMove(engineMove);
         
-        if (isEnPassantMove) {
-            // Capture en passant : la pièce capturée n'est pas sur la case de destination
-            capturedPiece = board_.getPieceAt(enPassantCapturePos);
-            if (capturedPiece) {
-                currentPlayer_->addCapturedPiece(capturedPiece->clone());
-                board_.removePieceAt(enPassantCapturePos);
-            }
-        } else {
-            // Capture normale
-            capturedPiece = board_.getPieceAt(move.getTo());
-            if (capturedPiece) {
-                currentPlayer_->addCapturedPiece(capturedPiece->clone());
-            }
+        // Gestion de la capture (en passant compris, jamais pour un roque)
+        int captured = board_.getLastCapturedPiece();
+        if (captured != BoardState::NO_PIECE) {
+            currentPlayer_->addCapturedPiece(PieceCode::fromIndex(captured));
         }
         
-        // Effectue le mouvement
-        board_.movePiece(move);
-        
         // Mise à jour de l'état de l'en passant pour le prochain tour
-        updateEnPassantState(move, pieceToMove);
+        updateEnPassantState();
         
         // Sauvegarde du dernier mouvement
-        lastMove_ = move;
+        lastMove_ = engineMove.toMove();
         
         // Change de joueur
         switchPlayer();
         
+        updateGameState();
+        
         return true;
     }
     
+    /**
+     * Décode un coup saisi en notation UCI ("e2e4", "e7e8n") ou SAN ("Nf3", "exd5", "O-O")
+     * @throws std::invalid_argument si le coup est mal formé, illégal ou ambigu
+     */
+    EngineMove parseMove(std::string_view text) const {
+        EngineMove move;
+        if (Notation::readUci(board_.getState(), text, move) == nullptr) {
+            return move;
+        }
+        return Notation::fromSan(board_.getState(), text);
+    }
+    
+    /**
+     * Écrit un coup légal de la position courante en SAN
+     */
+    std::string toSan(const EngineMove& move) const {
+        return Notation::toSan(board_.getState(), move);
+    }
+    
+    /**
+     * Annule le dernier mouvement joué
+     */
+    bool unmakeMove() {
+        if (board_.getHistorySize() == 0) {
+            return false;
+        }
+        
+        bool wasCapture = board_.getLastCapturedPiece() != BoardState::NO_PIECE;
+        board_.unmakeMove();
+        
+        switchPlayer();
+        if (wasCapture) {
+            currentPlayer_->removeLastCapturedPiece();
+        }
+        
+        updateEnPassantState();
+        EngineMove previous = board_.getLastMove();
+        lastMove_ = previous.isNone() ? Move(Position(0, 0), Position(0, 0)) : previous.toMove();
+        updateGameState();
+        
+        return true;
+    }
+    
+    /**
+     * Génère tous les coups légaux du joueur actuel
+     * (roque, prise en passant sur enPassantTarget_ et promotions compris)
+     */
+    void generateLegalMoves(MoveList& moves, GenerationType type = GenerationType::ALL) const {
+        MoveGenerator::generateLegalMoves(board_.getState(), moves, type);
+    }
+    
+    /**
+     * Vérifie si la partie est terminée (mat, pat ou nulle)
+     */
+    bool isGameOver() const {
+        return gameState_ == GameState::CHECKMATE || gameState_ == GameState::STALEMATE ||
+               gameState_ == GameState::DRAW;
+    }
+    
+    /**
+     * Vérifie si la position actuelle est apparue trois fois
+     */
+    bool isThreefoldRepetition() const {
+        return board_.getRepetitionCount() >= 2;
+    }
+    
     /**
      * Affiche le plateau
      */
@@ -157,6 +197,13 @@ public:
         BoardRenderer::renderUnicode(board_);
     }
     
+    /**
+     * Retourne le plateau (position et historique, pour le moteur)
+     */
+    const Board& getBoard() const {
+        return board_;
+    }
+    
     /**
      * Retourne le joueur actuel
      */
@@ -177,6 +224,7 @@ public:
     void displayScores() const {
         std::cout << "Score Blanc: " << whitePlayer_->getScore() << std::endl;
         std::cout << "Score Noir: " << blackPlayer_->getScore() << std::endl;
+        std::cout << "Évaluation (centipions, côté blanc): " << board_.getState().getTaperedScore() << std::endl;
         
         if (enPassantAvailable_) {
             char file = 'a' + enPassantTarget_.getX();
@@ -189,7 +237,7 @@ public:
      * Vérifie si un mouvement est valide et retourne un message d'erreur détaillé
      */
     std::string validateMoveWithMessage(const Move& move) const {
-        if (gameState_ != GameState::PLAYING) {
+        if (isGameOver()) {
             return "La partie n'est pas en cours";
         }
         
@@ -208,47 +256,90 @@ public:
             return "Erreur: Les " + playerColor + " ne peuvent pas déplacer une pièce " + pieceColor + "!";
         }
         
-        // Vérification spéciale pour l'en passant
-        if (pieceToMove->getType() == PieceType::PAWN && enPassantAvailable_) {
-            Pawn* pawn = static_cast<Pawn*>(pieceToMove);
-            if (pawn->canCaptureEnPassant(move.getTo(), enPassantTarget_)) {
-                return ""; // Mouvement d'en passant valide
-            }
+        EngineMove engineMove;
+        if (findLegalMove(move, engineMove)) {
+            return ""; // Coup légal (roque et en passant compris)
         }
         
         if (!MoveValidator::isValidMove(board_, move, currentPlayer_->getColor())) {
             return "Mouvement invalide selon les règles de cette pièce";
         }
         
-        return ""; // Mouvement valide
+        return "Ce mouvement laisserait votre roi en échec";
     }
     
 private:
+    /**
+     * Cherche parmi les coups légaux celui qui correspond au mouvement de l'interface
+     * En cas de promotion, la dame est choisie
+     */
+    bool findLegalMove(const Move& move, EngineMove& result) const {
+        if (!move.isValid()) {
+            return false;
+        }
+        
+        EngineMove wanted = EngineMove::fromMove(move);
+        
+        MoveList moves;
+        generateLegalMoves(moves);
+        for (const EngineMove& candidate : moves) {
+            if (candidate.isSameSquares(wanted) &&
+                (!candidate.isPromotion() || candidate.getPromotion() == PieceType::QUEEN)) {
+                result = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * Vérifie qu'un coup figure exactement (type et promotion compris) parmi les coups légaux
+     */
+    bool isLegalMove(const EngineMove& move) const {
+        MoveList moves;
+        generateLegalMoves(moves);
+        for (const EngineMove& candidate : moves) {
+            if (candidate == move) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
     /**
      * Change le joueur actuel
      */
     void switchPlayer() {
         currentPlayer_ = (currentPlayer_ == whitePlayer_.get()) ? blackPlayer_.get() : whitePlayer_.get();
+        board_.setSideToMove(currentPlayer_->getColor());
     }
     
     /**
-     * Met à jour l'état de l'en passant après un mouvement
+     * Met à jour l'état de la partie pour le joueur qui a le trait
+     * (échec, mat, pat, répétition ou règle des 50 coups)
      */
-    void updateEnPassantState(const Move& move, Piece* movedPiece) {
-        // Reset de l'en passant précédent
-        enPassantAvailable_ = false;
+    void updateGameState() {
+        MoveList moves;
+        generateLegalMoves(moves);
+        bool inCheck = board_.isInCheck(currentPlayer_->getColor());
         
-        // Vérifier si c'est un pion qui vient de bouger de 2 cases
-        if (movedPiece->getType() == PieceType::PAWN) {
-            int deltaY = abs(move.getTo().getY() - move.getFrom().getY());
-            
-            if (deltaY == 2) {
-                // Un pion vient de faire un mouvement de 2 cases
-                // L'en passant est disponible sur la case "traversée"
-                int enPassantY = (move.getFrom().getY() + move.getTo().getY()) / 2;
-                enPassantTarget_ = Position(move.getTo().getX(), enPassantY);
-                enPassantAvailable_ = true;
-            }
+        if (moves.empty()) {
+            gameState_ = inCheck ? GameState::CHECKMATE : GameState::STALEMATE;
+        } else if (isThreefoldRepetition() || board_.getState().getHalfmoveClock() >= 100) {
+            gameState_ = GameState::DRAW;
+        } else {
+            gameState_ = inCheck ? GameState::CHECK : GameState::PLAYING;
+        }
+    }
+    
+    /**
+     * Met à jour l'état de l'en passant depuis la position du plateau
+     */
+    void updateEnPassantState() {
+        int square = board_.getState().getEnPassantSquare();
+        enPassantAvailable_ = square != Bitboards::NO_SQUARE;
+        if (enPassantAvailable_) {
+            enPassantTarget_ = Position(Bitboards::fileOf(square), Bitboards::rankOf(square));
         }
     }
 };
@@ -0,0 +1,297 @@
+#ifndef MOVE_GENERATOR_HPP
+#define MOVE_GENERATOR_HPP
+
+#include "Attacks.hpp"
+#include "Bitboard.hpp"
+#include "BoardState.hpp"
+#include "PieceCode.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/GenerationType.hpp"
+#include "../Enums/PieceType.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/MoveList.hpp"
+
+/**
+ * Classe responsable de l'énumération des coups
+ * Produit les coups du camp au trait dans une MoveList, sans allocation
+ */
+class MoveGenerator {
+public:
+    /**
+     * Génère tous les coups légaux du camp au trait
+     * @param state La position
+     * @param moves La liste à remplir (vidée au préalable)
+     * @param type Tous les coups, captures et promotions seulement, ou coups calmes seulement
+     */
+    static void generateLegalMoves(const BoardState& state, MoveList& moves,
+                                   GenerationType type = GenerationType::ALL) {
+        generatePseudoLegalMoves(state, moves, type);
+
+        Color us = state.getSideToMove();
+        Bitboard king = state.getPieces(us, PieceType::KING);
+        if (!king) {
+            return;
+        }
+        int kingSquare = Bitboards::lsb(king);
+        Bitboard pinned = state.getPinned(us);
+        Bitboard checkers = state.getCheckers();
+
+        // En échec simple, les autres pièces doivent prendre l'attaquant ou s'interposer ;
+        // en échec double, seul le roi peut bouger
+        Bitboard evasionMask = ~Bitboards::EMPTY;
+        if (checkers) {
+            evasionMask = (checkers & (checkers - 1))
+                ? Bitboards::EMPTY
+                : checkers | Attacks::between(kingSquare, Bitboards::lsb(checkers));
+        }
+
+        // Les coups du roi et l'en passant gardent le test complet ;
+        // une pièce clouée ne peut que rester sur la ligne de son roi
+        int kept = 0;
+        for (int i = 0; i < moves.size(); ++i) {
+            const EngineMove& move = moves[i];
+            int from = move.getFrom();
+            int to = move.getTo();
+            bool legal;
+            if (from == kingSquare || move.isEnPassant()) {
+                legal = isLegal(state, move);
+            } else {
+                legal = Bitboards::contains(evasionMask, to) &&
+                        (!Bitboards::contains(pinned, from) || Bitboards::contains(Attacks::line(kingSquare, from), to));
+            }
+            if (legal) {
+                moves[kept++] = move;
+            }
+        }
+        moves.resize(kept);
+    }
+
+    /**
+     * Génère les coups pseudo-légaux (le roi peut rester en échec)
+     * Le roque n'est produit que s'il est entièrement légal.
+     */
+    static void generatePseudoLegalMoves(const BoardState& state, MoveList& moves,
+                                         GenerationType type = GenerationType::ALL) {
+        moves.clear();
+
+        Color us = state.getSideToMove();
+        Bitboard ours = state.getOccupancy(us);
+        Bitboard theirs = state.getOccupancy(oppositeColor(us));
+        Bitboard occupied = ours | theirs;
+
+        Bitboard targets = type == GenerationType::CAPTURES ? theirs
+                         : type == GenerationType::QUIETS   ? ~occupied
+                                                            : ~ours;
+
+        generatePawnMoves(state, moves, type);
+
+        for (PieceType pieceType : {PieceType::KNIGHT, PieceType::BISHOP, PieceType::ROOK,
+                                    PieceType::QUEEN, PieceType::KING}) {
+            Bitboard pieces = state.getPieces(us, pieceType);
+            while (pieces) {
+                int from = Bitboards::popLsb(pieces);
+                Bitboard attacks = Attacks::pieceAttacks(pieceType, from, occupied) & targets;
+                while (attacks) {
+                    moves.add(EngineMove(from, Bitboards::popLsb(attacks)));
+                }
+            }
+        }
+
+        if (type != GenerationType::CAPTURES) {
+            generateCastlingMoves(state, moves);
+        }
+    }
+
+    /**
+     * Vérifie qu'un coup pseudo-légal ne laisse pas son roi en échec
+     * La position n'est pas jouée : l'occupation après le coup suffit aux tables d'attaque.
+     */
+    static bool isLegal(const BoardState& state, const EngineMove& move) {
+        if (move.isCastling()) {
+            return true; // Déjà vérifié à la génération
+        }
+
+        Color us = state.getSideToMove();
+        Bitboard king = state.getPieces(us, PieceType::KING);
+        if (!king) {
+            return true;
+        }
+
+        int from = move.getFrom();
+        int to = move.getTo();
+        int kingSquare = Bitboards::lsb(king);
+        if (from == kingSquare) {
+            kingSquare = to;
+        }
+
+        // Case de la pièce capturée : différente de la destination pour l'en passant
+        Bitboard captured = Bitboards::squareBB(move.isEnPassant() ? (to ^ 8) : to);
+        Bitboard occupied = (state.getOccupancy() & ~Bitboards::squareBB(from) & ~captured) |
+                            Bitboards::squareBB(to);
+        Bitboard enemies = state.getOccupancy(oppositeColor(us)) & ~captured;
+
+        return (state.attackersTo(kingSquare, occupied) & enemies) == 0;
+    }
+
+    /**
+     * Vérifie qu'un coup mémorisé (table de transposition, coup tueur) est pseudo-légal ici
+     * Ces coups peuvent venir d'une autre position ; avec isLegal, le test équivaut
+     * à une recherche dans la liste des coups légaux, sans la générer.
+     */
+    static bool isPseudoLegal(const BoardState& state, const EngineMove& move) {
+        // Un coup lu dans la table doit aussi être bien formé (pas de pièce de promotion parasite)
+        if (move.isNone() ||
+            EngineMove(move.getFrom(), move.getTo(), move.getKind(), move.getPromotion()).getRaw() != move.getRaw()) {
+            return false;
+        }
+
+        Color us = state.getSideToMove();
+        int from = move.getFrom();
+        int to = move.getTo();
+        PieceCode piece = state.pieceAt(from);
+        if (piece.isNone() || piece.getColor() != us || Bitboards::contains(state.getOccupancy(us), to)) {
+            return false;
+        }
+
+        if (move.isCastling()) {
+            MoveList castles;
+            generateCastlingMoves(state, castles);
+            return castles.contains(move);
+        }
+
+        PieceType type = piece.getType();
+        if (type != PieceType::PAWN) {
+            return !move.isPromotion() && !move.isEnPassant() &&
+                   Bitboards::contains(Attacks::pieceAttacks(type, from, state.getOccupancy()), to);
+        }
+
+        if (move.isEnPassant()) {
+            return to == state.getEnPassantSquare() && Bitboards::contains(Attacks::pawnAttacks(us, from), to);
+        }
+        Bitboard lastRank = us == Color::WHITE ? Bitboards::RANK_8 : Bitboards::RANK_1;
+        if (Bitboards::contains(lastRank, to) != move.isPromotion()) {
+            return false;
+        }
+
+        int up = us == Color::WHITE ? 8 : -8;
+        if (Bitboards::contains(Attacks::pawnAttacks(us, from), to)) {
+            return Bitboards::contains(state.getOccupancy(oppositeColor(us)), to);
+        }
+        if (to == from + up) {
+            return state.isEmpty(to);
+        }
+        Bitboard startRank = us == Color::WHITE ? Bitboards::RANK_2 : Bitboards::RANK_7;
+        return to == from + 2 * up && Bitboards::contains(startRank, from) &&
+               state.isEmpty(from + up) && state.isEmpty(to);
+    }
+
+private:
+    static Bitboard pushForward(Bitboard bb, Color color) {
+        return color == Color::WHITE ? bb << 8 : bb >> 8;
+    }
+
+    static void addPromotions(MoveList& moves, int from, int to) {
+        moves.add(EngineMove(from, to, EngineMove::Kind::PROMOTION, PieceType::QUEEN));
+        moves.add(EngineMove(from, to, EngineMove::Kind::PROMOTION, PieceType::KNIGHT));
+        moves.add(EngineMove(from, to, EngineMove::Kind::PROMOTION, PieceType::ROOK));
+        moves.add(EngineMove(from, to, EngineMove::Kind::PROMOTION, PieceType::BISHOP));
+    }
+
+    /**
+     * Poussées simples et doubles, captures, promotions et prise en passant
+     */
+    static void generatePawnMoves(const BoardState& state, MoveList& moves, GenerationType type) {
+        Color us = state.getSideToMove();
+        Bitboard pawns = state.getPieces(us, PieceType::PAWN);
+        Bitboard theirs = state.getOccupancy(oppositeColor(us));
+        Bitboard empty = ~state.getOccupancy();
+        Bitboard lastRank = us == Color::WHITE ? Bitboards::RANK_8 : Bitboards::RANK_1;
+        Bitboard doublePushRank = us == Color::WHITE ? Bitboards::RANK_3 : Bitboards::RANK_6;
+        int up = us == Color::WHITE ? 8 : -8;
+
+        Bitboard singlePushes = pushForward(pawns, us) & empty;
+
+        if (type != GenerationType::CAPTURES) {
+            Bitboard quietPushes = singlePushes & ~lastRank;
+            Bitboard doublePushes = pushForward(quietPushes & doublePushRank, us) & empty;
+            while (quietPushes) {
+                int to = Bitboards::popLsb(quietPushes);
+                moves.add(EngineMove(to - up, to));
+            }
+            while (doublePushes) {
+                int to = Bitboards::popLsb(doublePushes);
+                moves.add(EngineMove(to - 2 * up, to));
+            }
+        }
+
+        if (type == GenerationType::QUIETS) {
+            return;
+        }
+
+        Bitboard promotionPushes = singlePushes & lastRank;
+        while (promotionPushes) {
+            int to = Bitboards::popLsb(promotionPushes);
+            addPromotions(moves, to - up, to);
+        }
+
+        Bitboard capturers = pawns;
+        while (capturers) {
+            int from = Bitboards::popLsb(capturers);
+            Bitboard captures = Attacks::pawnAttacks(us, from) & theirs;
+            while (captures) {
+                int to = Bitboards::popLsb(captures);
+                if (Bitboards::contains(lastRank, to)) {
+                    addPromotions(moves, from, to);
+                } else {
+                    moves.add(EngineMove(from, to));
+                }
+            }
+        }
+
+        int enPassantSquare = state.getEnPassantSquare();
+        if (enPassantSquare != Bitboards::NO_SQUARE) {
+            // Les pions qui attaquent la case en passant sont ceux qu'un pion adverse y attaquerait
+            Bitboard attackers = Attacks::pawnAttacks(oppositeColor(us), enPassantSquare) & pawns;
+            while (attackers) {
+                moves.add(EngineMove(Bitboards::popLsb(attackers), enPassantSquare,
+                                     EngineMove::Kind::EN_PASSANT));
+            }
+        }
+    }
+
+    /**
+     * Petit et grand roque, seulement s'ils sont légaux :
+     * cases libres, roi hors d'échec et cases traversées non attaquées
+     */
+    static void generateCastlingMoves(const BoardState& state, MoveList& moves) {
+        Color us = state.getSideToMove();
+        Color them = oppositeColor(us);
+        bool white = us == Color::WHITE;
+        int kingFrom = white ? 4 : 60;
+
+        if (!Bitboards::contains(state.getPieces(us, PieceType::KING), kingFrom) ||
+            state.isSquareAttackedBy(kingFrom, them)) {
+            return;
+        }
+
+        Bitboard occupied = state.getOccupancy();
+        Bitboard rooks = state.getPieces(us, PieceType::ROOK);
+
+        std::uint8_t kingSide = white ? BoardState::WHITE_KING_SIDE : BoardState::BLACK_KING_SIDE;
+        if (state.hasCastlingRight(kingSide) && Bitboards::contains(rooks, kingFrom + 3) &&
+            !(occupied & (Bitboards::squareBB(kingFrom + 1) | Bitboards::squareBB(kingFrom + 2))) &&
+            !state.isSquareAttackedBy(kingFrom + 1, them) && !state.isSquareAttackedBy(kingFrom + 2, them)) {
+            moves.add(EngineMove(kingFrom, kingFrom + 2, EngineMove::Kind::CASTLING));
+        }
+
+        std::uint8_t queenSide = white ? BoardState::WHITE_QUEEN_SIDE : BoardState::BLACK_QUEEN_SIDE;
+        if (state.hasCastlingRight(queenSide) && Bitboards::contains(rooks, kingFrom - 4) &&
+            !(occupied & (Bitboards::squareBB(kingFrom - 1) | Bitboards::squareBB(kingFrom - 2) |
+                          Bitboards::squareBB(kingFrom - 3))) &&
+            !state.isSquareAttackedBy(kingFrom - 1, them) && !state.isSquareAttackedBy(kingFrom - 2, them)) {
+            moves.add(EngineMove(kingFrom, kingFrom - 2, EngineMove::Kind::CASTLING));
+        }
+    }
+};
+
+#endif // MOVE_GENERATOR_HPP
\ No newline at end of file
@@ -2,9 +2,10 @@
 #define MOVE_VALIDATOR_HPP
 
 #include "../Core/Board.hpp"
+#include "../Core/Attacks.hpp"
+#include "../Core/Bitboard.hpp"
+#include "../Core/PieceCode.hpp"
 #include "../Utils/Move.hpp"
-#include "../Pieces/Piece.hpp"
-#include "../Pieces/Pawn.hpp"
 
 /**
  * Classe responsable de la validation des mouvements
@@ -21,58 +22,58 @@ public:
             return false;
         }
         
-        Piece* piece = board.getPieceAt(move.getFrom());
-        if (!piece) {
+        const BoardState& state = board.getState();
+        int from = Bitboards::squareIndex(move.getFrom().getX(), move.getFrom().getY());
+        int to = Bitboards::squareIndex(move.getTo().getX(), move.getTo().getY());
+        
+        PieceCode piece = state.pieceAt(from);
+        if (piece.isNone()) {
             return false; // Pas de pièce à déplacer
         }
         
         // SÉCURITÉ CRITIQUE: Le joueur ne peut déplacer que ses propres pièces
-        if (piece->getColor() != playerColor) {
+        if (piece.getColor() != playerColor) {
             return false; // Ce n'est pas la pièce du joueur - TENTATIVE DE TRICHE DÉTECTÉE
         }
         
-        // Vérifie si la pièce peut faire ce mouvement selon ses règles
-        if (!piece->canMoveTo(move.getTo())) {
-            return false;
-        }
-        
         // Vérifie la destination
-        Piece* targetPiece = board.getPieceAt(move.getTo());
-        if (targetPiece && targetPiece->getColor() == playerColor) {
+        if (Bitboards::contains(state.getOccupancy(playerColor), to)) {
             return false; // Ne peut pas capturer ses propres pièces
         }
         
-        // Vérifie si le chemin est libre (sauf pour le cavalier)
-        if (piece->getType() != PieceType::KNIGHT) {
-            if (!board.isPathClear(move.getFrom(), move.getTo())) {
-                return false;
-            }
-        }
+        PieceType type = piece.getType();
         
         // Règles spéciales pour le pion
-        if (piece->getType() == PieceType::PAWN) {
-            return validatePawnMove(board, move, *static_cast<Pawn*>(piece));
+        if (type == PieceType::PAWN) {
+            if (!PieceRules::canMove(piece, from, to) || !board.isPathClear(move.getFrom(), move.getTo())) {
+                return false;
+            }
+            return validatePawnMove(board, move, playerColor);
         }
         
-        return true;
+        // Autres pièces : une consultation des tables d'attaque remplace
+        // la vérification du motif de déplacement et le parcours du chemin
+        return Bitboards::contains(Attacks::pieceAttacks(type, from, state.getOccupancy()), to);
     }
     
 private:
     /**
      * Valide spécifiquement les mouvements de pion
      */
-    static bool validatePawnMove(const Board& board, const Move& move, const Pawn& pawn) {
-        Piece* targetPiece = board.getPieceAt(move.getTo());
+    static bool validatePawnMove(const Board& board, const Move& move, Color color) {
+        bool targetOccupied = !board.isEmpty(move.getTo());
         
         // Si c'est un mouvement de capture en diagonale
         if (abs(move.getDeltaX()) == 1) {
-            return pawn.canCapture(move.getTo()) && targetPiece != nullptr;
+            return targetOccupied &&
+                   PieceRules::canPawnCapture(color, Square::fromPosition(move.getFrom()).index(),
+                                              Square::fromPosition(move.getTo()).index());
         }
         
         // Si c'est un mouvement vers l'avant
         if (move.getDeltaX() == 0) {
             // La case de destination doit être vide
-            if (targetPiece != nullptr) {
+            if (targetOccupied) {
                 return false;
             }
             
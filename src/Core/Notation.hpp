@@ -0,0 +1,355 @@
+#ifndef NOTATION_HPP
+#define NOTATION_HPP
+
+#include "Attacks.hpp"
+#include "Bitboard.hpp"
+#include "BoardState.hpp"
+#include "MoveGenerator.hpp"
+#include "PieceCode.hpp"
+#include "../Enums/PieceType.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/MoveList.hpp"
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * Conversion entre coups du moteur et notations textuelles (SAN et UCI)
+ * Le décodage s'appuie sur les règles du générateur de coups : aucune position n'est copiée.
+ */
+class Notation {
+public:
+    /**
+     * Décode un coup en notation algébrique abrégée (SAN, ex: "Nbd7", "exd6", "O-O", "e8=Q+")
+     * @throws std::invalid_argument si le coup est mal formé, illégal ou ambigu
+     */
+    static EngineMove fromSan(const BoardState& state, std::string_view san) {
+        EngineMove move;
+        const char* error = readSan(state, san, move);
+        if (error) {
+            throw std::invalid_argument(std::string(error) + " : " + std::string(san));
+        }
+        return move;
+    }
+
+    /**
+     * Décode un coup SAN sans exception ni allocation
+     * Seules les pièces du bon type qui atteignent la case d'arrivée sont examinées
+     * (tables d'attaque inversées), puis leur légalité est vérifiée sans jouer le coup.
+     * @param state La position (le coup est joué par le camp au trait)
+     * @param san Le coup ; les suffixes +, #, ! et ? sont ignorés
+     * @param move Reçoit le coup légal correspondant
+     * @return nullptr en cas de succès, sinon la description de l'erreur
+     */
+    static const char* readSan(const BoardState& state, std::string_view san, EngineMove& move) noexcept {
+        while (!san.empty() && (san.back() == '+' || san.back() == '#' || san.back() == '!' || san.back() == '?')) {
+            san.remove_suffix(1);
+        }
+        if (san.size() < 2) {
+            return "coup mal formé";
+        }
+
+        // Roques (la lettre O ou le chiffre 0) : rares, pris dans la liste des coups légaux
+        if (san == "O-O" || san == "0-0" || san == "O-O-O" || san == "0-0-0") {
+            bool kingSide = san.size() == 3;
+            MoveList moves;
+            MoveGenerator::generateLegalMoves(state, moves, GenerationType::QUIETS);
+            for (const EngineMove& candidate : moves) {
+                if (candidate.isCastling() && (candidate.getTo() > candidate.getFrom()) == kingSide) {
+                    move = candidate;
+                    return nullptr;
+                }
+            }
+            return "roque illégal";
+        }
+
+        PieceType type = PieceType::PAWN;
+        size_t begin = 0;
+        if (isPieceLetter(san[0])) {
+            type = pieceFromLetter(san[0]);
+            begin = 1;
+        }
+
+        // Promotion en fin de coup : "e8=Q" ou "e8Q"
+        bool promotion = false;
+        PieceType promotionType = PieceType::QUEEN;
+        size_t end = san.size();
+        if (type == PieceType::PAWN && isPieceLetter(san[end - 1]) && san[end - 1] != 'K') {
+            promotion = true;
+            promotionType = pieceFromLetter(san[end - 1]);
+            --end;
+            if (end > 0 && san[end - 1] == '=') {
+                --end;
+            }
+        }
+
+        // Case d'arrivée : les deux derniers caractères restants
+        if (end < begin + 2 || !isFile(san[end - 2]) || !isRank(san[end - 1])) {
+            return "coup mal formé";
+        }
+        int to = Bitboards::squareIndex(san[end - 2] - 'a', san[end - 1] - '1');
+
+        // Désambiguïsation éventuelle (colonne, rangée ou les deux), puis 'x' facultatif
+        Bitboard allowed = ~Bitboards::EMPTY;
+        for (size_t i = begin; i < end - 2; ++i) {
+            char c = san[i];
+            if (isFile(c)) {
+                allowed &= Bitboards::FILE_A << (c - 'a');
+            } else if (isRank(c)) {
+                allowed &= Bitboards::RANK_1 << (8 * (c - '1'));
+            } else if (c != 'x' && c != ':' && c != '-') {
+                return "coup mal formé";
+            }
+        }
+
+        Color us = state.getSideToMove();
+        if (Bitboards::contains(state.getOccupancy(us), to)) {
+            return "coup illégal";
+        }
+
+        EngineMove::Kind kind = EngineMove::Kind::NORMAL;
+        Bitboard origins = Bitboards::EMPTY;
+        if (type == PieceType::PAWN) {
+            bool lastRank = Bitboards::rankOf(to) == (us == Color::WHITE ? 7 : 0);
+            if (promotion != lastRank) {
+                return "coup illégal";
+            }
+            // Une prise de pion nomme sa colonne de départ ("exd5") ; une case seule est une poussée
+            bool capture = isFile(san[begin]) && end - begin > 2;
+            origins = pawnOrigins(state, to, capture);
+            if (capture && to == state.getEnPassantSquare()) {
+                kind = EngineMove::Kind::EN_PASSANT;
+            } else if (promotion) {
+                kind = EngineMove::Kind::PROMOTION;
+            }
+        } else {
+            origins = Attacks::pieceAttacks(type, to, state.getOccupancy()) & state.getPieces(us, type);
+        }
+
+        int found = 0;
+        origins &= allowed;
+        while (origins) {
+            EngineMove candidate(Bitboards::popLsb(origins), to, kind, promotionType);
+            if (MoveGenerator::isLegal(state, candidate)) {
+                move = candidate;
+                ++found;
+            }
+        }
+
+        if (found == 0) {
+            return "coup illégal";
+        }
+        return found == 1 ? nullptr : "coup ambigu";
+    }
+
+    /**
+     * Encode un coup légal en SAN (désambiguïsation minimale, suffixe + ou #)
+     */
+    static std::string toSan(const BoardState& state, const EngineMove& move) {
+        std::string san;
+        appendSan(state, move, san);
+        return san;
+    }
+
+    /**
+     * Ajoute la SAN d'un coup légal à une chaîne (évite une allocation par coup à l'export)
+     */
+    static void appendSan(const BoardState& state, const EngineMove& move, std::string& out) {
+        int from = move.getFrom();
+        int to = move.getTo();
+
+        if (move.isCastling()) {
+            out += to > from ? "O-O" : "O-O-O";
+        } else {
+            PieceType type = state.pieceAt(from).getType();
+            bool capture = move.isEnPassant() || !state.isEmpty(to);
+
+            if (type == PieceType::PAWN) {
+                if (capture) {
+                    out += static_cast<char>('a' + Bitboards::fileOf(from));
+                }
+            } else {
+                out += pieceLetter(type);
+                appendDisambiguation(state, move, type, out);
+            }
+
+            if (capture) {
+                out += 'x';
+            }
+            out += static_cast<char>('a' + Bitboards::fileOf(to));
+            out += static_cast<char>('1' + Bitboards::rankOf(to));
+
+            if (move.isPromotion()) {
+                out += '=';
+                out += pieceLetter(move.getPromotion());
+            }
+        }
+
+        // Suffixe d'échec : seule cette partie joue le coup, sur une copie locale
+        BoardState after = state;
+        UndoInfo undo;
+        after.makeMove(move, undo);
+        if (after.getCheckers()) {
+            MoveList replies;
+            MoveGenerator::generateLegalMoves(after, replies);
+            out += replies.empty() ? '#' : '+';
+        }
+    }
+
+    /**
+     * Encode un coup en notation UCI (ex: "e2e4", "e7e8q", roque "e1g1")
+     */
+    static std::string toUci(const EngineMove& move) {
+        return move.isNone() ? "0000" : move.toString();
+    }
+
+    /**
+     * Décode un coup UCI
+     * @throws std::invalid_argument si le coup est mal formé ou illégal
+     */
+    static EngineMove fromUci(const BoardState& state, std::string_view uci) {
+        EngineMove move;
+        const char* error = readUci(state, uci, move);
+        if (error) {
+            throw std::invalid_argument(std::string(error) + " : " + std::string(uci));
+        }
+        return move;
+    }
+
+    /**
+     * Décode un coup UCI sans exception ni allocation
+     * @return nullptr en cas de succès, sinon la description de l'erreur
+     */
+    static const char* readUci(const BoardState& state, std::string_view uci, EngineMove& move) noexcept {
+        if ((uci.size() != 4 && uci.size() != 5) || !isFile(uci[0]) || !isRank(uci[1]) ||
+            !isFile(uci[2]) || !isRank(uci[3])) {
+            return "coup mal formé";
+        }
+
+        int from = Bitboards::squareIndex(uci[0] - 'a', uci[1] - '1');
+        int to = Bitboards::squareIndex(uci[2] - 'a', uci[3] - '1');
+        bool promotion = uci.size() == 5;
+        PieceType promotionType = PieceType::QUEEN;
+        if (promotion) {
+            char letter = static_cast<char>(uci[4] & ~0x20); // majuscule
+            if (!isPieceLetter(letter) || letter == 'K') {
+                return "pièce de promotion invalide";
+            }
+            promotionType = pieceFromLetter(letter);
+        }
+
+        MoveList moves;
+        MoveGenerator::generateLegalMoves(state, moves);
+        for (const EngineMove& candidate : moves) {
+            if (candidate.getFrom() == from && candidate.getTo() == to && candidate.isPromotion() == promotion &&
+                (!promotion || candidate.getPromotion() == promotionType)) {
+                move = candidate;
+                return nullptr;
+            }
+        }
+        return "coup illégal";
+    }
+
+private:
+    static constexpr bool isFile(char c) { return c >= 'a' && c <= 'h'; }
+    static constexpr bool isRank(char c) { return c >= '1' && c <= '8'; }
+
+    static constexpr bool isPieceLetter(char c) {
+        return c == 'N' || c == 'B' || c == 'R' || c == 'Q' || c == 'K';
+    }
+
+    static constexpr char pieceLetter(PieceType type) {
+        switch (type) {
+            case PieceType::KNIGHT: return 'N';
+            case PieceType::BISHOP: return 'B';
+            case PieceType::ROOK:   return 'R';
+            case PieceType::QUEEN:  return 'Q';
+            case PieceType::KING:   return 'K';
+            default:                return 'P';
+        }
+    }
+
+    /**
+     * Cases d'où un pion du camp au trait peut atteindre 'to'
+     * @param capture Prise (sur une pièce adverse ou en passant), sinon poussée simple ou double
+     */
+    static Bitboard pawnOrigins(const BoardState& state, int to, bool capture) {
+        Color us = state.getSideToMove();
+        Bitboard pawns = state.getPieces(us, PieceType::PAWN);
+        int up = us == Color::WHITE ? 8 : -8;
+
+        if (capture) {
+            if (state.isEmpty(to) && to != state.getEnPassantSquare()) {
+                return Bitboards::EMPTY;
+            }
+            // Les pions qui prennent sur 'to' sont ceux qu'un pion adverse y attaquerait
+            return Attacks::pawnAttacks(oppositeColor(us), to) & pawns;
+        }
+        if (!state.isEmpty(to)) {
+            return Bitboards::EMPTY;
+        }
+
+        Bitboard origins = Bitboards::EMPTY;
+        int single = to - up;
+        if (single >= 0 && single < Bitboards::SQUARE_COUNT) {
+            if (Bitboards::contains(pawns, single)) {
+                origins |= Bitboards::squareBB(single);
+            } else if (state.isEmpty(single) && Bitboards::rankOf(to) == (us == Color::WHITE ? 3 : 4) &&
+                       Bitboards::contains(pawns, single - up)) {
+                origins |= Bitboards::squareBB(single - up);
+            }
+        }
+        return origins;
+    }
+
+    /**
+     * Colonne, rangée ou case de départ quand une autre pièce du même type
+     * peut légalement aller sur la même case
+     */
+    static void appendDisambiguation(const BoardState& state, const EngineMove& move, PieceType type,
+                                     std::string& out) {
+        int from = move.getFrom();
+        int to = move.getTo();
+        Color us = state.getSideToMove();
+        Bitboard others = Attacks::pieceAttacks(type, to, state.getOccupancy()) &
+                          state.getPieces(us, type) & ~Bitboards::squareBB(from);
+
+        bool ambiguous = false;
+        bool sameFile = false;
+        bool sameRank = false;
+        while (others) {
+            int other = Bitboards::popLsb(others);
+            if (!MoveGenerator::isLegal(state, EngineMove(other, to))) {
+                continue;
+            }
+            ambiguous = true;
+            sameFile |= Bitboards::fileOf(other) == Bitboards::fileOf(from);
+            sameRank |= Bitboards::rankOf(other) == Bitboards::rankOf(from);
+        }
+
+        if (!ambiguous) {
+            return;
+        }
+        if (!sameFile) {
+            out += static_cast<char>('a' + Bitboards::fileOf(from));
+        } else if (!sameRank) {
+            out += static_cast<char>('1' + Bitboards::rankOf(from));
+        } else {
+            out += static_cast<char>('a' + Bitboards::fileOf(from));
+            out += static_cast<char>('1' + Bitboards::rankOf(from));
+        }
+    }
+
+    static constexpr PieceType pieceFromLetter(char c) {
+        switch (c) {
+            case 'N': return PieceType::KNIGHT;
+            case 'B': return PieceType::BISHOP;
+            case 'R': return PieceType::ROOK;
+            case 'Q': return PieceType::QUEEN;
+            case 'K': return PieceType::KING;
+            default:  return PieceType::PAWN;
+        }
+    }
+};
+
+#endif // NOTATION_HPP
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef PACKED_POSITION_HPP
+#define PACKED_POSITION_HPP
+
+#include "Bitboard.hpp"
+#include "BoardState.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Position compressée sur 32 octets pour stocker de grandes séries de positions
+ * L'occupation donne les cases occupées ; chaque pièce y est codée sur 4 bits
+ * (index BoardState::pieceIndex), dans l'ordre croissant des cases.
+ * Limite : 32 pièces au plus, ce que respecte toute position légale.
+ */
+struct PackedPosition {
+    static constexpr int MAX_PIECES = 32;
+
+    Bitboard occupancy;
+    std::array<std::uint8_t, MAX_PIECES / 2> pieces;
+    std::uint8_t flags;            // bit 0 : noirs au trait, bits 1-4 : droits de roque
+    std::int8_t enPassantSquare;
+    std::uint16_t halfmoveClock;
+    std::uint16_t fullmoveNumber;
+    std::uint16_t reserved;
+
+    /**
+     * Compresse une position
+     * @return false si la position compte plus de 32 pièces
+     */
+    static bool pack(const BoardState& state, PackedPosition& packed) {
+        Bitboard occupied = state.getOccupancy();
+        if (Bitboards::popCount(occupied) > MAX_PIECES) {
+            return false;
+        }
+
+        packed.occupancy = occupied;
+        packed.pieces.fill(0);
+        int count = 0;
+        while (occupied) {
+            int index = state.pieceIndexAt(Bitboards::popLsb(occupied));
+            packed.pieces[count / 2] |= static_cast<std::uint8_t>(index << ((count & 1) * 4));
+            ++count;
+        }
+
+        packed.flags = static_cast<std::uint8_t>((state.getSideToMove() == Color::BLACK ? 1 : 0) |
+                                                 (state.getCastlingRights() << 1));
+        packed.enPassantSquare = static_cast<std::int8_t>(state.getEnPassantSquare());
+        packed.halfmoveClock = static_cast<std::uint16_t>(state.getHalfmoveClock());
+        packed.fullmoveNumber = static_cast<std::uint16_t>(state.getFullmoveNumber());
+        packed.reserved = 0;
+        return true;
+    }
+
+    /**
+     * Reconstruit la position complète (clés de Zobrist comprises)
+     */
+    BoardState unpack() const {
+        BoardState state;
+        Bitboard occupied = occupancy;
+        int count = 0;
+        while (occupied) {
+            int square = Bitboards::popLsb(occupied);
+            int index = (pieces[count / 2] >> ((count & 1) * 4)) & 0xF;
+            state.putPiece(square, BoardState::colorOfIndex(index), BoardState::typeOfIndex(index));
+            ++count;
+        }
+        state.setSideToMove((flags & 1) ? Color::BLACK : Color::WHITE);
+        state.setCastlingRights(static_cast<std::uint8_t>(flags >> 1));
+        state.setEnPassantSquare(enPassantSquare);
+        state.setHalfmoveClock(halfmoveClock);
+        state.setFullmoveNumber(fullmoveNumber);
+        return state;
+    }
+};
+
+static_assert(sizeof(PackedPosition) == 32, "PackedPosition doit tenir sur 32 octets");
+static_assert(std::is_trivially_copyable<PackedPosition>::value, "PackedPosition doit rester copiable par memcpy");
+
+#endif // PACKED_POSITION_HPP
\ No newline at end of file
@@ -0,0 +1,175 @@
+#ifndef PIECE_CODE_HPP
+#define PIECE_CODE_HPP
+
+#include "Attacks.hpp"
+#include "Bitboard.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/PieceType.hpp"
+#include "../Utils/Constants.hpp"
+#include <array>
+#include <cstdint>
+
+/**
+ * Pièce codée sur un octet : couleur * 6 + type
+ * Même numérotation que BoardState::pieceIndex, la valeur 12 signifiant "aucune pièce".
+ * Type valeur sans allocation ni vtable, utilisé par le cœur du moteur à la place de Piece.
+ */
+class PieceCode {
+private:
+    static constexpr int TYPE_COUNT = 6;
+    static constexpr std::uint8_t NONE = 2 * TYPE_COUNT;
+
+    std::uint8_t code_;
+
+public:
+    constexpr PieceCode() noexcept : code_(NONE) {}
+
+    constexpr PieceCode(Color color, PieceType type) noexcept
+        : code_(static_cast<std::uint8_t>(static_cast<int>(color) * TYPE_COUNT + static_cast<int>(type))) {}
+
+    static constexpr PieceCode none() noexcept {
+        return PieceCode();
+    }
+
+    /**
+     * Conversion depuis un index de BoardState (négatif = case vide)
+     */
+    static constexpr PieceCode fromIndex(int index) noexcept {
+        PieceCode piece;
+        if (index >= 0 && index < NONE) {
+            piece.code_ = static_cast<std::uint8_t>(index);
+        }
+        return piece;
+    }
+
+    // Getters (la pièce ne doit pas être vide, sauf pour isNone et index)
+    constexpr bool isNone() const noexcept { return code_ == NONE; }
+    constexpr Color getColor() const noexcept { return code_ < TYPE_COUNT ? Color::WHITE : Color::BLACK; }
+    constexpr PieceType getType() const noexcept { return static_cast<PieceType>(code_ % TYPE_COUNT); }
+    constexpr int index() const noexcept { return isNone() ? -1 : code_; }
+
+    constexpr bool operator==(const PieceCode& other) const noexcept { return code_ == other.code_; }
+    constexpr bool operator!=(const PieceCode& other) const noexcept { return code_ != other.code_; }
+
+    /**
+     * Lettre de la pièce en notation FEN (majuscule pour les blancs), '.' si vide
+     */
+    constexpr char toChar() const noexcept {
+        return isNone() ? '.' : "RNBQKPrnbqkp"[symbolIndex()];
+    }
+
+private:
+    // Ordre des lettres ci-dessus : tour, cavalier, fou, dame, roi, pion
+    constexpr int symbolIndex() const noexcept {
+        constexpr int ORDER[TYPE_COUNT] = {5, 0, 1, 2, 3, 4}; // indexé par PieceType
+        return ORDER[code_ % TYPE_COUNT] + (code_ < TYPE_COUNT ? 0 : TYPE_COUNT);
+    }
+};
+
+/**
+ * Règles de déplacement des pièces sous forme de tables (plateau vide)
+ * Remplacent les canMoveTo virtuels : un test de motif est une lecture de bit.
+ * Les obstacles restent à vérifier à part (Attacks, Board::isPathClear).
+ */
+namespace PieceRules {
+
+    namespace detail {
+        using SquareTable = std::array<Bitboard, Bitboards::SQUARE_COUNT>;
+
+        constexpr SquareTable slidingTable(const int (&directions)[4][2]) {
+            SquareTable table{};
+            for (int square = 0; square < Bitboards::SQUARE_COUNT; ++square) {
+                table[square] = Attacks::detail::slidingAttacks(square, Bitboards::EMPTY, directions);
+            }
+            return table;
+        }
+
+        constexpr SquareTable queenTable() {
+            SquareTable rook = slidingTable(Attacks::detail::ROOK_DIRECTIONS);
+            SquareTable bishop = slidingTable(Attacks::detail::BISHOP_DIRECTIONS);
+            SquareTable table{};
+            for (int square = 0; square < Bitboards::SQUARE_COUNT; ++square) {
+                table[square] = rook[square] | bishop[square];
+            }
+            return table;
+        }
+
+        /**
+         * Poussées de pion : une case, deux depuis la rangée de départ
+         */
+        constexpr SquareTable pawnPushTable(Color color) {
+            SquareTable table{};
+            int direction = color == Color::WHITE ? 1 : -1;
+            int startRank = color == Color::WHITE ? 1 : 6;
+            for (int square = 0; square < Bitboards::SQUARE_COUNT; ++square) {
+                int x = Bitboards::fileOf(square);
+                int y = Bitboards::rankOf(square) + direction;
+                if (y < 0 || y >= ChessConstants::BOARD_SIZE) {
+                    continue;
+                }
+                table[square] = Bitboards::squareBB(Bitboards::squareIndex(x, y));
+                if (Bitboards::rankOf(square) == startRank) {
+                    table[square] |= Bitboards::squareBB(Bitboards::squareIndex(x, y + direction));
+                }
+            }
+            return table;
+        }
+
+        // Indexé par PieceType ; l'entrée du pion est vide (il dépend de la couleur)
+        constexpr std::array<SquareTable, 6> PSEUDO_MOVES = {
+            SquareTable{},
+            slidingTable(Attacks::detail::ROOK_DIRECTIONS),
+            Attacks::detail::KNIGHT,
+            slidingTable(Attacks::detail::BISHOP_DIRECTIONS),
+            queenTable(),
+            Attacks::detail::KING
+        };
+
+        constexpr std::array<SquareTable, 2> PAWN_PUSHES = {
+            pawnPushTable(Color::WHITE), pawnPushTable(Color::BLACK)
+        };
+
+        // Indexé par PieceType
+        constexpr int VALUES[6] = {
+            ChessConstants::PieceValues::PAWN,
+            ChessConstants::PieceValues::ROOK,
+            ChessConstants::PieceValues::KNIGHT,
+            ChessConstants::PieceValues::BISHOP,
+            ChessConstants::PieceValues::QUEEN,
+            ChessConstants::PieceValues::KING
+        };
+    }
+
+    /**
+     * Valeur matérielle d'un type de pièce (score des captures)
+     */
+    constexpr int value(PieceType type) {
+        return detail::VALUES[static_cast<int>(type)];
+    }
+
+    /**
+     * Cases atteignables sur un plateau vide (poussées et prises pour un pion)
+     */
+    constexpr Bitboard pseudoMoves(PieceCode piece, int from) {
+        return piece.getType() == PieceType::PAWN
+            ? detail::PAWN_PUSHES[static_cast<int>(piece.getColor())][from] |
+              Attacks::pawnAttacks(piece.getColor(), from)
+            : detail::PSEUDO_MOVES[static_cast<int>(piece.getType())][from];
+    }
+
+    /**
+     * Vérifie le motif de déplacement d'une pièce (sans obstacles ni échec)
+     */
+    constexpr bool canMove(PieceCode piece, int from, int to) {
+        return !piece.isNone() && Bitboards::contains(pseudoMoves(piece, from), to);
+    }
+
+    /**
+     * Prise en diagonale d'un pion (motif seulement)
+     */
+    constexpr bool canPawnCapture(Color color, int from, int to) {
+        return Bitboards::contains(Attacks::pawnAttacks(color, from), to);
+    }
+}
+
+#endif // PIECE_CODE_HPP
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef ZOBRIST_HPP
+#define ZOBRIST_HPP
+
+#include "Bitboard.hpp"
+#include <array>
+#include <cstdint>
+
+/**
+ * Clés de Zobrist pour l'identité des positions
+ * Générées à la compilation (splitmix64, graine fixe) : aucun coût au démarrage
+ * et des clés identiques d'une exécution à l'autre.
+ */
+namespace Zobrist {
+
+    using Key = std::uint64_t;
+
+    namespace detail {
+        constexpr int PIECE_KEYS = 12 * Bitboards::SQUARE_COUNT;
+        constexpr int CASTLING_KEYS = 4;
+        constexpr int EN_PASSANT_KEYS = 8;
+        constexpr int KEY_COUNT = PIECE_KEYS + CASTLING_KEYS + EN_PASSANT_KEYS + 1;
+
+        constexpr std::array<Key, KEY_COUNT> generateKeys() {
+            std::array<Key, KEY_COUNT> keys{};
+            Key state = 0x9E3779B97F4A7C15ULL ^ 0x43484553534B4559ULL;
+            for (Key& key : keys) {
+                state += 0x9E3779B97F4A7C15ULL;
+                Key z = state;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                key = z ^ (z >> 31);
+            }
+            return keys;
+        }
+
+        constexpr std::array<Key, KEY_COUNT> KEYS = generateKeys();
+
+        /**
+         * Une clé par combinaison de droits de roque (XOR des droits présents)
+         */
+        constexpr std::array<Key, 16> generateCastlingKeys() {
+            std::array<Key, 16> keys{};
+            for (int rights = 0; rights < 16; ++rights) {
+                for (int bit = 0; bit < CASTLING_KEYS; ++bit) {
+                    if (rights & (1 << bit)) {
+                        keys[rights] ^= KEYS[PIECE_KEYS + bit];
+                    }
+                }
+            }
+            return keys;
+        }
+
+        constexpr std::array<Key, 16> CASTLING = generateCastlingKeys();
+    }
+
+    /**
+     * Clé d'une pièce (index BoardState::pieceIndex) sur une case
+     */
+    constexpr Key piece(int pieceIndex, int square) {
+        return detail::KEYS[pieceIndex * Bitboards::SQUARE_COUNT + square];
+    }
+
+    constexpr Key castling(int rights) {
+        return detail::CASTLING[rights];
+    }
+
+    constexpr Key enPassantFile(int file) {
+        return detail::KEYS[detail::PIECE_KEYS + detail::CASTLING_KEYS + file];
+    }
+
+    /**
+     * Présente dans la clé quand les noirs ont le trait
+     */
+    constexpr Key blackToMove() {
+        return detail::KEYS[detail::KEY_COUNT - 1];
+    }
+}
+
+#endif // ZOBRIST_HPP
\ No newline at end of file
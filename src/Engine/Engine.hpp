@@ -0,0 +1,295 @@
+#ifndef ENGINE_HPP
+#define ENGINE_HPP
+
+#include "Nnue.hpp"
+#include "ParallelSearch.hpp"
+#include "Search.hpp"
+#include "SearchLimits.hpp"
+#include "TranspositionTable.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/Zobrist.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Option réglable du moteur (commande UCI "setoption")
+ */
+struct EngineOption {
+    enum class Type { SPIN, CHECK, BUTTON, STRING };
+
+    std::string name;
+    Type type;
+    std::string defaultValue;
+    int min = 0;
+    int max = 0;
+    std::string value;
+    std::function<void(const EngineOption&)> onChange;
+
+    int asInt() const { return std::stoi(value); }
+    bool asBool() const { return value == "true"; }
+};
+
+/**
+ * Moteur de jeu : position courante, options et thread de recherche
+ *
+ * La recherche tourne dans son propre thread pour que l'appelant (la boucle UCI)
+ * reste disponible : stop() lève un drapeau atomique lu à chaque nœud.
+ * Avec l'option "Threads", ce thread est le thread principal d'une recherche Lazy SMP.
+ * L'option "EvalFile" charge un réseau NNUE, partagé en lecture par tous les threads.
+ * Une seule recherche à la fois ; go() attend la fin de la précédente.
+ */
+class Engine {
+public:
+    using InfoListener = Search::Listener;
+    using BestMoveListener = std::function<void(const EngineMove&)>;
+
+private:
+    BoardState position_;
+    std::vector<Zobrist::Key> history_;
+    std::vector<EngineOption> options_;
+    TranspositionTable table_;
+    // Threads assistants de Lazy SMP (option "Threads" moins le thread de recherche principal)
+    std::unique_ptr<ThreadPool> helpers_;
+    // Réseau d'évaluation (option "EvalFile"), ou nullptr pour l'évaluation classique
+    std::unique_ptr<Nnue::NetworkFile> network_;
+    std::string optionError_;
+
+    std::thread thread_;
+    std::atomic<bool> stop_;
+    std::mutex mutex_;
+    std::condition_variable stopRequested_;
+
+public:
+    static constexpr int DEFAULT_HASH_MB = 16;
+    static constexpr int MAX_HASH_MB = 1 << 16;
+    static constexpr int MAX_THREADS = 512;
+
+    Engine() : position_(BoardState::startingPosition()), table_(DEFAULT_HASH_MB), stop_(false) {
+        addSpinOption("Hash", DEFAULT_HASH_MB, 1, MAX_HASH_MB, [this](const EngineOption& option) {
+            table_.resize(static_cast<size_t>(option.asInt()));
+        });
+        addButtonOption("Clear Hash", [this](const EngineOption&) { table_.clear(threadCount()); });
+        addSpinOption("Threads", 1, 1, MAX_THREADS, [this](const EngineOption& option) {
+            size_t count = static_cast<size_t>(option.asInt());
+            helpers_ = count > 1 ? std::make_unique<ThreadPool>(count - 1) : nullptr;
+        });
+        addSpinOption("Move Overhead", 30, 0, 5000);
+        addStringOption("EvalFile", "", [this](const EngineOption& option) {
+            // Les interfaces envoient "<empty>" pour une chaîne vide
+            bool none = option.value.empty() || option.value == "<empty>";
+            network_ = none ? nullptr : std::make_unique<Nnue::NetworkFile>(option.value);
+        });
+    }
+
+    ~Engine() {
+        stop();
+    }
+
+    Engine(const Engine&) = delete;
+    Engine& operator=(const Engine&) = delete;
+
+    /**
+     * Prépare une nouvelle partie (commande "ucinewgame")
+     */
+    void newGame() {
+        stop();
+        position_ = BoardState::startingPosition();
+        history_.clear();
+        table_.clear(threadCount());
+    }
+
+    /**
+     * Fixe la position de départ puis joue les coups donnés
+     * @param moves Coups légaux, déjà décodés (ex: Notation::readUci)
+     */
+    void setPosition(const BoardState& start, const std::vector<EngineMove>& moves) {
+        stop();
+        position_ = start;
+        history_.clear();
+        UndoInfo undo;
+        for (const EngineMove& move : moves) {
+            history_.push_back(position_.getHash());
+            position_.makeMove(move, undo);
+            // Au-delà du dernier coup irréversible aucune position ne peut se répéter
+            if (position_.getHalfmoveClock() == 0) {
+                history_.clear();
+            }
+        }
+    }
+
+    const BoardState& getPosition() const { return position_; }
+
+    const std::vector<EngineOption>& getOptions() const { return options_; }
+
+    /**
+     * Modifie une option (nom insensible à la casse)
+     * @return nullptr en cas de succès, sinon la description de l'erreur (valide jusqu'à l'appel suivant)
+     */
+    const char* setOption(const std::string& name, const std::string& value) {
+        EngineOption* option = findOption(name);
+        if (!option) {
+            return "option inconnue";
+        }
+        std::string previous = option->value;
+
+        switch (option->type) {
+            case EngineOption::Type::SPIN: {
+                int number = 0;
+                try {
+                    number = std::stoi(value);
+                } catch (const std::exception&) {
+                    return "valeur numérique attendue";
+                }
+                option->value = std::to_string(std::clamp(number, option->min, option->max));
+                break;
+            }
+            case EngineOption::Type::CHECK:
+                if (value != "true" && value != "false") {
+                    return "valeur true ou false attendue";
+                }
+                option->value = value;
+                break;
+            case EngineOption::Type::BUTTON:
+                break;
+            case EngineOption::Type::STRING:
+                option->value = value;
+                break;
+        }
+
+        // Une option peut réallouer des structures partagées : aucune recherche ne doit tourner
+        stop();
+        if (option->onChange) {
+            try {
+                option->onChange(*option);
+            } catch (const std::runtime_error& error) {
+                // Valeur refusée (fichier illisible...) : l'option garde son effet précédent
+                option->value = previous;
+                optionError_ = error.what();
+                return optionError_.c_str();
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Lance une recherche dans le thread du moteur et rend la main aussitôt
+     * @param onInfo Appelé (depuis le thread de recherche) après chaque itération
+     * @param onBestMove Appelé (depuis le thread de recherche) avec le coup choisi
+     */
+    void go(const SearchLimits& limits, InfoListener onInfo, BestMoveListener onBestMove) {
+        stop();
+        stop_ = false;
+
+        BoardState root = position_;
+        std::vector<Zobrist::Key> history = history_;
+        std::int64_t overhead = findOption("Move Overhead")->asInt();
+
+        thread_ = std::thread([this, root, history, limits, overhead, onInfo, onBestMove] {
+            EngineMove best = ParallelSearch::run(root, history, limits, stop_, &table_, helpers_.get(), overhead, onInfo,
+                                                  network_ ? &network_->network() : nullptr);
+
+            // En analyse infinie, le coup n'est rendu qu'à la demande de l'interface
+            if (limits.infinite) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                stopRequested_.wait(lock, [this] { return stop_.load(); });
+            }
+            onBestMove(best);
+        });
+    }
+
+    /**
+     * Interrompt la recherche en cours et attend que son coup ait été rendu
+     */
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        stopRequested_.notify_all();
+        wait();
+    }
+
+    /**
+     * Attend la fin de la recherche en cours (sans l'interrompre)
+     */
+    void wait() {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    /**
+     * Ajoute une option entière ; onChange est appelé à chaque modification
+     */
+    EngineOption& addSpinOption(const std::string& name, int defaultValue, int min, int max,
+                                std::function<void(const EngineOption&)> onChange = nullptr) {
+        EngineOption option;
+        option.name = name;
+        option.type = EngineOption::Type::SPIN;
+        option.defaultValue = std::to_string(defaultValue);
+        option.min = min;
+        option.max = max;
+        option.value = option.defaultValue;
+        option.onChange = std::move(onChange);
+        options_.push_back(std::move(option));
+        return options_.back();
+    }
+
+    /**
+     * Ajoute un bouton (option sans valeur qui déclenche une action)
+     */
+    EngineOption& addButtonOption(const std::string& name, std::function<void(const EngineOption&)> onChange) {
+        EngineOption option;
+        option.name = name;
+        option.type = EngineOption::Type::BUTTON;
+        option.onChange = std::move(onChange);
+        options_.push_back(std::move(option));
+        return options_.back();
+    }
+
+    /**
+     * Ajoute une option texte ; onChange peut lever std::runtime_error pour refuser la valeur
+     */
+    EngineOption& addStringOption(const std::string& name, const std::string& defaultValue,
+                                  std::function<void(const EngineOption&)> onChange = nullptr) {
+        EngineOption option;
+        option.name = name;
+        option.type = EngineOption::Type::STRING;
+        option.defaultValue = defaultValue;
+        option.value = defaultValue;
+        option.onChange = std::move(onChange);
+        options_.push_back(std::move(option));
+        return options_.back();
+    }
+
+private:
+    size_t threadCount() const {
+        return helpers_ ? helpers_->size() + 1 : 1;
+    }
+
+    EngineOption* findOption(const std::string& name) {
+        for (EngineOption& option : options_) {
+            if (option.name.size() == name.size() &&
+                std::equal(name.begin(), name.end(), option.name.begin(), [](char a, char b) {
+                    return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+                })) {
+                return &option;
+            }
+        }
+        return nullptr;
+    }
+};
+
+#endif // ENGINE_HPP
\ No newline at end of file
@@ -0,0 +1,112 @@
+#ifndef EVALUATION_HPP
+#define EVALUATION_HPP
+
+#include "Nnue.hpp"
+#include "PawnTable.hpp"
+#include "../Core/Bitboard.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/PieceSquareTables.hpp"
+#include "../Enums/Color.hpp"
+#include "../Utils/EngineMove.hpp"
+#include <memory>
+
+/**
+ * Évaluation statique d'une position, propre à un thread de recherche
+ *
+ * Matériel et tables pièce-case sont lus dans BoardState, qui les tient à jour ;
+ * les termes de structure de pions et l'abri du roi viennent de la table de pions.
+ * Seul le bonus des pions passés dont la case d'avance est libre dépend des autres
+ * pièces : il est calculé à chaque appel à partir des masques de la table.
+ *
+ * Avec un réseau NNUE (setNetwork), c'est lui qui évalue : la recherche signale alors
+ * chaque coup par push()/pop() pour que ses accumulateurs suivent la position.
+ * Sans réseau, ces appels ne coûtent rien.
+ */
+class Evaluator {
+private:
+    PawnTable pawnTable_;
+    std::unique_ptr<Nnue::AccumulatorStack> accumulators_;   // Seulement avec un réseau
+
+    // Pion passé que rien ne bloque, selon sa rangée relative (fin de partie)
+    static constexpr int FREE_PASSER_EG[8] = {0, 0, 5, 10, 15, 25, 40, 0};
+
+public:
+    /**
+     * Score en centipions du point de vue du camp au trait
+     */
+    int evaluate(const BoardState& state) {
+        if (accumulators_) {
+            return accumulators_->evaluate(state);
+        }
+        PawnEntry& pawns = pawnTable_.probe(state);
+        int mg = state.getMidgameScore() + pawns.mg + PawnTable::shelter(state, pawns, Color::WHITE) -
+                 PawnTable::shelter(state, pawns, Color::BLACK);
+        int eg = state.getEndgameScore() + pawns.eg + freePassers(state, pawns, Color::WHITE) -
+                 freePassers(state, pawns, Color::BLACK);
+        int score = PieceSquare::taper(mg, eg, state.getPhase());
+        return state.getSideToMove() == Color::WHITE ? score : -score;
+    }
+
+    /**
+     * Évalue avec un réseau (nullptr : retour à l'évaluation classique)
+     * Le réseau doit rester chargé tant que l'évaluateur s'en sert.
+     */
+    void setNetwork(const Nnue::Network* network) {
+        if (!network) {
+            accumulators_.reset();
+            return;
+        }
+        if (!accumulators_) {
+            accumulators_ = std::make_unique<Nnue::AccumulatorStack>();
+        }
+        accumulators_->setNetwork(network);
+    }
+
+    bool usesNetwork() const { return accumulators_ != nullptr; }
+
+    /**
+     * Position de départ des coups signalés ensuite
+     */
+    void reset(const BoardState& state) {
+        if (accumulators_) {
+            accumulators_->reset(state);
+        }
+    }
+
+    /**
+     * À appeler juste avant state.makeMove(move)
+     */
+    void push(const BoardState& state, const EngineMove& move) {
+        if (accumulators_) {
+            accumulators_->push(state, move);
+        }
+    }
+
+    /**
+     * À appeler après unmakeMove
+     */
+    void pop() {
+        if (accumulators_) {
+            accumulators_->pop();
+        }
+    }
+
+    const PawnTable& getPawnTable() const { return pawnTable_; }
+
+private:
+    static int freePassers(const BoardState& state, const PawnEntry& pawns, Color color) {
+        int score = 0;
+        Bitboard passed = pawns.passed[static_cast<int>(color)];
+        while (passed) {
+            int square = Bitboards::popLsb(passed);
+            int stop = color == Color::WHITE ? square + 8 : square - 8;
+            if (state.isEmpty(stop)) {
+                int rank = color == Color::WHITE ? Bitboards::rankOf(square) : 7 - Bitboards::rankOf(square);
+                score += FREE_PASSER_EG[rank];
+            }
+        }
+        return score;
+    }
+};
+
+#endif // EVALUATION_HPP
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef MOVE_HISTORY_HPP
+#define MOVE_HISTORY_HPP
+
+#include "../Core/BoardState.hpp"
+#include "../Utils/EngineMove.hpp"
+#include <cstdint>
+#include <cstdlib>
+
+/**
+ * Statistiques d'ordre des coups calmes, propres à chaque thread de recherche
+ *
+ * - butterfly[camp][départ][arrivée] : succès du coup quelle que soit la position
+ * - continuation[pièce][case] : succès selon le coup précédent (pièce jouée, case d'arrivée)
+ * - counterMoves[pièce][case] : dernier coup calme qui a réfuté le coup précédent
+ *
+ * Les valeurs restent dans [-MAX_VALUE, MAX_VALUE] : chaque mise à jour les attire
+ * vers la borne proportionnellement à la distance qui les en sépare.
+ */
+struct MoveHistory {
+    static constexpr int MAX_VALUE = 16384;
+    static constexpr int SQUARES = Bitboards::SQUARE_COUNT;
+    static constexpr int PIECES = BoardState::PIECE_COUNT;
+
+    // Historique d'un coup selon la pièce jouée et sa case d'arrivée
+    using PieceToHistory = std::int16_t[PIECES][SQUARES];
+
+    std::int16_t butterfly[2][SQUARES][SQUARES];
+    PieceToHistory continuation[PIECES][SQUARES];
+    EngineMove counterMoves[PIECES][SQUARES];
+
+    MoveHistory() {
+        clear();
+    }
+
+    void clear() {
+        for (auto& side : butterfly) {
+            for (auto& row : side) {
+                for (std::int16_t& value : row) {
+                    value = 0;
+                }
+            }
+        }
+        for (auto& previousPiece : continuation) {
+            for (PieceToHistory& table : previousPiece) {
+                for (auto& row : table) {
+                    for (std::int16_t& value : row) {
+                        value = 0;
+                    }
+                }
+            }
+        }
+        for (auto& row : counterMoves) {
+            for (EngineMove& move : row) {
+                move = EngineMove::none();
+            }
+        }
+    }
+
+    /**
+     * Bonus (positif) ou malus (négatif) avec saturation douce
+     */
+    static void update(std::int16_t& value, int bonus) {
+        value = static_cast<std::int16_t>(value + bonus - value * std::abs(bonus) / MAX_VALUE);
+    }
+
+    /**
+     * Bonus d'une coupure à une profondeur donnée
+     */
+    static int bonus(int depth) {
+        int value = 32 * depth * depth;
+        return value < MAX_BONUS ? value : MAX_BONUS;
+    }
+
+private:
+    static constexpr int MAX_BONUS = 2048;
+};
+
+#endif // MOVE_HISTORY_HPP
\ No newline at end of file
@@ -0,0 +1,253 @@
+#ifndef MOVE_PICKER_HPP
+#define MOVE_PICKER_HPP
+
+#include "MoveHistory.hpp"
+#include "StaticExchange.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/MoveGenerator.hpp"
+#include "../Core/PieceCode.hpp"
+#include "../Enums/GenerationType.hpp"
+#include "../Enums/PieceType.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/MoveList.hpp"
+#include <utility>
+
+/**
+ * Fournit les coups légaux d'un nœud un par un, du plus prometteur au moins prometteur
+ *
+ * Les coups sont produits par étapes, chacune n'étant générée et notée que lorsqu'elle
+ * est atteinte : une coupure sur le coup de la table évite toute génération.
+ *   1. coup de la table de transposition (ou de la variation principale)
+ *   2. captures et promotions gagnantes ou égales selon la SEE, par MVV-LVA
+ *      (victime la plus chère, attaquant le moins cher)
+ *   3. deux coups tueurs, puis le contre-coup du coup précédent
+ *   4. coups calmes, par historique butterfly et historiques de continuation
+ *   5. captures perdantes, mises de côté à l'étape 2
+ * Un coup déjà proposé à une étape précédente n'est jamais rendu deux fois.
+ *
+ * Pour la recherche de repos, seules les étapes 1 et 2 sont parcourues : les captures
+ * perdantes sont écartées. En échec, toutes les parades sont rendues comme d'habitude.
+ */
+class MovePicker {
+public:
+    using PieceToHistory = MoveHistory::PieceToHistory;
+
+private:
+    enum class Stage {
+        TABLE_MOVE,
+        GENERATE_CAPTURES,
+        CAPTURES,
+        FIRST_KILLER,
+        SECOND_KILLER,
+        COUNTER_MOVE,
+        GENERATE_QUIETS,
+        QUIETS,
+        BAD_CAPTURES,
+        DONE
+    };
+
+    const BoardState& state_;
+    const MoveHistory& history_;
+    EngineMove tableMove_;
+    EngineMove killers_[2];
+    EngineMove counterMove_;
+    // Historiques de continuation du coup précédent et de celui d'avant (nullptr si absent)
+    const PieceToHistory* continuation_[2];
+
+    Stage stage_;
+    bool capturesOnly_;
+    MoveList moves_;
+    MoveList badCaptures_;
+    int scores_[MoveList::MAX_MOVES];
+    int next_;
+
+public:
+    MovePicker(const BoardState& state, const MoveHistory& history, const EngineMove& tableMove,
+               const EngineMove& firstKiller, const EngineMove& secondKiller, const EngineMove& counterMove,
+               const PieceToHistory* previous, const PieceToHistory* beforePrevious)
+        : state_(state), history_(history), tableMove_(tableMove), killers_{firstKiller, secondKiller},
+          counterMove_(counterMove), continuation_{previous, beforePrevious}, stage_(Stage::TABLE_MOVE),
+          capturesOnly_(false), next_(0) {}
+
+    /**
+     * Constructeur pour la recherche de repos : coup de la table et captures non perdantes,
+     * ou toutes les parades si le roi est en échec
+     */
+    MovePicker(const BoardState& state, const MoveHistory& history, const EngineMove& tableMove)
+        : MovePicker(state, history, tableMove, EngineMove::none(), EngineMove::none(), EngineMove::none(),
+                     nullptr, nullptr) {
+        capturesOnly_ = !state.getCheckers();
+        if (capturesOnly_ && !tableMove_.isNone() && isQuiet(state, tableMove_)) {
+            tableMove_ = EngineMove::none();
+        }
+    }
+
+    /**
+     * Coup suivant, ou EngineMove::none() quand tous les coups légaux ont été rendus
+     */
+    EngineMove next() {
+        while (true) {
+            switch (stage_) {
+                case Stage::TABLE_MOVE:
+                    stage_ = Stage::GENERATE_CAPTURES;
+                    if (isValid(tableMove_)) {
+                        return tableMove_;
+                    }
+                    break;
+
+                case Stage::GENERATE_CAPTURES:
+                    MoveGenerator::generateLegalMoves(state_, moves_, GenerationType::CAPTURES);
+                    for (int i = 0; i < moves_.size(); ++i) {
+                        scores_[i] = captureScore(moves_[i]);
+                    }
+                    next_ = 0;
+                    stage_ = Stage::CAPTURES;
+                    break;
+
+                case Stage::CAPTURES: {
+                    EngineMove move = selectBest();
+                    if (move.isNone()) {
+                        stage_ = capturesOnly_ ? Stage::DONE : Stage::FIRST_KILLER;
+                        break;
+                    }
+                    // La SEE n'est calculée que pour les captures effectivement atteintes
+                    if (StaticExchange::evaluate(state_, move) < 0) {
+                        badCaptures_.add(move);
+                        break;
+                    }
+                    return move;
+                }
+
+                case Stage::FIRST_KILLER:
+                    stage_ = Stage::SECOND_KILLER;
+                    if (isQuietCandidate(killers_[0])) {
+                        return killers_[0];
+                    }
+                    break;
+
+                case Stage::SECOND_KILLER:
+                    stage_ = Stage::COUNTER_MOVE;
+                    if (!(killers_[1] == killers_[0]) && isQuietCandidate(killers_[1])) {
+                        return killers_[1];
+                    }
+                    break;
+
+                case Stage::COUNTER_MOVE:
+                    stage_ = Stage::GENERATE_QUIETS;
+                    if (!(counterMove_ == killers_[0]) && !(counterMove_ == killers_[1]) &&
+                        isQuietCandidate(counterMove_)) {
+                        return counterMove_;
+                    }
+                    break;
+
+                case Stage::GENERATE_QUIETS:
+                    MoveGenerator::generateLegalMoves(state_, moves_, GenerationType::QUIETS);
+                    for (int i = 0; i < moves_.size(); ++i) {
+                        scores_[i] = quietScore(moves_[i]);
+                    }
+                    next_ = 0;
+                    stage_ = Stage::QUIETS;
+                    break;
+
+                case Stage::QUIETS: {
+                    EngineMove move = selectBest();
+                    if (move.isNone()) {
+                        next_ = 0;
+                        stage_ = Stage::BAD_CAPTURES;
+                        break;
+                    }
+                    if (move == killers_[0] || move == killers_[1] || move == counterMove_) {
+                        break;
+                    }
+                    return move;
+                }
+
+                case Stage::BAD_CAPTURES:
+                    if (next_ < badCaptures_.size()) {
+                        return badCaptures_[next_++];
+                    }
+                    stage_ = Stage::DONE;
+                    break;
+
+                case Stage::DONE:
+                    return EngineMove::none();
+            }
+        }
+    }
+
+    /**
+     * Vrai si le coup ne prend rien et ne promeut pas (candidat aux historiques et aux coups tueurs)
+     */
+    static bool isQuiet(const BoardState& state, const EngineMove& move) {
+        return !move.isPromotion() && !move.isEnPassant() && state.isEmpty(move.getTo());
+    }
+
+private:
+    /**
+     * Sélection du meilleur coup restant de l'étape (tri par sélection, fait au fil de l'eau)
+     * Le coup de la table, déjà rendu, est sauté.
+     */
+    EngineMove selectBest() {
+        while (next_ < moves_.size()) {
+            int best = next_;
+            for (int i = next_ + 1; i < moves_.size(); ++i) {
+                if (scores_[i] > scores_[best]) {
+                    best = i;
+                }
+            }
+            std::swap(moves_[next_], moves_[best]);
+            std::swap(scores_[next_], scores_[best]);
+            EngineMove move = moves_[next_++];
+            if (!(move == tableMove_)) {
+                return move;
+            }
+        }
+        return EngineMove::none();
+    }
+
+    bool isValid(const EngineMove& move) const {
+        return MoveGenerator::isPseudoLegal(state_, move) && MoveGenerator::isLegal(state_, move);
+    }
+
+    bool isQuietCandidate(const EngineMove& move) const {
+        return !(move == tableMove_) && isValid(move) && isQuiet(state_, move);
+    }
+
+    int captureScore(const EngineMove& move) const {
+        PieceType attacker = state_.pieceAt(move.getFrom()).getType();
+        PieceType victim = move.isEnPassant() ? PieceType::PAWN : state_.pieceAt(move.getTo()).getType();
+        int score = 0;
+        if (!state_.isEmpty(move.getTo()) || move.isEnPassant()) {
+            score += VICTIM_WEIGHT * PieceRules::value(victim) - attackerOrder(attacker);
+        }
+        if (move.isPromotion()) {
+            score += VICTIM_WEIGHT * PieceRules::value(move.getPromotion());
+        }
+        return score;
+    }
+
+    int quietScore(const EngineMove& move) const {
+        int from = move.getFrom();
+        int to = move.getTo();
+        int piece = state_.pieceIndexAt(from);
+        int score = history_.butterfly[static_cast<int>(state_.getSideToMove())][from][to];
+        for (const PieceToHistory* continuation : continuation_) {
+            if (continuation) {
+                score += (*continuation)[piece][to];
+            }
+        }
+        return score;
+    }
+
+    /**
+     * Coût de l'attaquant pour MVV-LVA : le roi passe en dernier
+     */
+    static int attackerOrder(PieceType type) {
+        return type == PieceType::KING ? KING_ORDER : PieceRules::value(type);
+    }
+
+    static constexpr int VICTIM_WEIGHT = 16;
+    static constexpr int KING_ORDER = 10;
+};
+
+#endif // MOVE_PICKER_HPP
\ No newline at end of file
@@ -0,0 +1,492 @@
+#ifndef NNUE_HPP
+#define NNUE_HPP
+
+#include "../Core/BoardState.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/PieceType.hpp"
+#include "../IO/MappedFile.hpp"
+#include "../Utils/EngineMove.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CHESS_NNUE_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Réseau d'évaluation à mise à jour efficace (NNUE), architecture HalfKP réduite
+ *
+ * Entrées : pour chaque point de vue (blancs, noirs), une caractéristique par triplet
+ * (case de son roi, pièce hors roi, case), les cases étant retournées pour les noirs.
+ * Couche 1 : 40960 -> 128 en int16, tenue à jour par coup dans un accumulateur.
+ * Puis les deux accumulateurs (camp au trait d'abord), écrêtés à [0, 127] en octets,
+ * traversent deux couches denses int8 (256 -> 32 -> 32) et une sortie 32 -> 1.
+ *
+ * Les poids sont lus directement dans le fichier projeté en mémoire (format ci-dessous,
+ * petit-boutiste, sections alignées sur 64 octets). Les noyaux de calcul existent en AVX2,
+ * SSE4.1 et scalaire ; le meilleur disponible est choisi à l'exécution.
+ */
+namespace Nnue {
+
+    constexpr int SQUARES = Bitboards::SQUARE_COUNT;
+    constexpr int PIECE_KINDS = 10;                       // 5 types hors roi x (à nous, à l'adversaire)
+    constexpr int FEATURES = SQUARES * PIECE_KINDS * SQUARES;
+    constexpr int L1 = 128;                               // Largeur d'un accumulateur
+    constexpr int L2 = 32;
+    constexpr int L3 = 32;
+    constexpr int WEIGHT_SHIFT = 6;                       // Mise à l'échelle après chaque couche dense
+    constexpr int OUTPUT_SCALE = 16;                      // Sortie / OUTPUT_SCALE = centipions
+    constexpr int CLIP = 127;
+    // Pièces hors rois au plus : bornent le nombre de colonnes d'un rafraîchissement
+    constexpr int MAX_ACTIVE = 32;
+
+    constexpr char MAGIC[8] = {'C', 'H', 'E', 'S', 'S', 'N', 'N', '1'};
+    constexpr size_t HEADER_SIZE = 64;
+
+    constexpr size_t alignSection(size_t bytes) {
+        return (bytes + 63) / 64 * 64;
+    }
+
+    // Disposition du fichier : en-tête puis chaque section, dans cet ordre
+    constexpr size_t FEATURE_BIAS_OFFSET = HEADER_SIZE;
+    constexpr size_t FEATURE_WEIGHTS_OFFSET = FEATURE_BIAS_OFFSET + alignSection(L1 * sizeof(std::int16_t));
+    constexpr size_t L1_BIAS_OFFSET =
+        FEATURE_WEIGHTS_OFFSET + alignSection(static_cast<size_t>(FEATURES) * L1 * sizeof(std::int16_t));
+    constexpr size_t L1_WEIGHTS_OFFSET = L1_BIAS_OFFSET + alignSection(L2 * sizeof(std::int32_t));
+    constexpr size_t L2_BIAS_OFFSET = L1_WEIGHTS_OFFSET + alignSection(L2 * 2 * L1);
+    constexpr size_t L2_WEIGHTS_OFFSET = L2_BIAS_OFFSET + alignSection(L3 * sizeof(std::int32_t));
+    constexpr size_t OUTPUT_BIAS_OFFSET = L2_WEIGHTS_OFFSET + alignSection(L3 * L2);
+    constexpr size_t OUTPUT_WEIGHTS_OFFSET = OUTPUT_BIAS_OFFSET + alignSection(sizeof(std::int32_t));
+    constexpr size_t FILE_SIZE = OUTPUT_WEIGHTS_OFFSET + alignSection(L3);
+
+    /**
+     * Vues sur les poids (aucune copie : elles pointent dans le fichier projeté)
+     */
+    struct Network {
+        const std::int16_t* featureBias;      // [L1]
+        const std::int16_t* featureWeights;   // [FEATURES][L1]
+        const std::int32_t* l1Bias;           // [L2]
+        const std::int8_t* l1Weights;         // [L2][2 * L1]
+        const std::int32_t* l2Bias;           // [L3]
+        const std::int8_t* l2Weights;         // [L3][L2]
+        const std::int32_t* outputBias;       // [1]
+        const std::int8_t* outputWeights;     // [L3]
+
+        const std::int16_t* column(int feature) const {
+            return featureWeights + static_cast<size_t>(feature) * L1;
+        }
+    };
+
+    /**
+     * Colonne de la caractéristique (pièce, case) vue par un camp dont le roi est sur kingSquare
+     */
+    inline int featureIndex(Color perspective, int kingSquare, int pieceIndex, int square) {
+        int flip = perspective == Color::WHITE ? 0 : 56;
+        int kind = 2 * static_cast<int>(BoardState::typeOfIndex(pieceIndex)) +
+                   (BoardState::colorOfIndex(pieceIndex) == perspective ? 0 : 1);
+        return ((kingSquare ^ flip) * PIECE_KINDS + kind) * SQUARES + (square ^ flip);
+    }
+
+    /**
+     * Noyaux de calcul d'un jeu d'instructions
+     */
+    struct Kernels {
+        const char* name;
+        // output = input + somme des colonnes ajoutées - somme des colonnes retirées (L1 valeurs)
+        void (*update)(std::int16_t* output, const std::int16_t* input, const std::int16_t* const* added,
+                       int addedCount, const std::int16_t* const* removed, int removedCount);
+        // Produit scalaire octets non signés x poids int8, longueur multiple de 32
+        std::int32_t (*dot)(const std::uint8_t* input, const std::int8_t* weights, int length);
+        // Écrêtage de deux accumulateurs en 2 * L1 octets dans [0, CLIP]
+        void (*clip)(std::uint8_t* output, const std::int16_t* us, const std::int16_t* them);
+    };
+
+    namespace detail {
+
+        inline void updateScalar(std::int16_t* output, const std::int16_t* input, const std::int16_t* const* added,
+                                 int addedCount, const std::int16_t* const* removed, int removedCount) {
+            for (int i = 0; i < L1; ++i) {
+                int value = input[i];
+                for (int k = 0; k < addedCount; ++k) {
+                    value += added[k][i];
+                }
+                for (int k = 0; k < removedCount; ++k) {
+                    value -= removed[k][i];
+                }
+                output[i] = static_cast<std::int16_t>(value);
+            }
+        }
+
+        inline std::int32_t dotScalar(const std::uint8_t* input, const std::int8_t* weights, int length) {
+            std::int32_t sum = 0;
+            for (int i = 0; i < length; ++i) {
+                sum += static_cast<std::int32_t>(input[i]) * weights[i];
+            }
+            return sum;
+        }
+
+        inline void clipScalar(std::uint8_t* output, const std::int16_t* us, const std::int16_t* them) {
+            for (int i = 0; i < L1; ++i) {
+                output[i] = static_cast<std::uint8_t>(std::clamp<int>(us[i], 0, CLIP));
+                output[L1 + i] = static_cast<std::uint8_t>(std::clamp<int>(them[i], 0, CLIP));
+            }
+        }
+
+        constexpr Kernels SCALAR = {"scalaire", updateScalar, dotScalar, clipScalar};
+
+#if defined(CHESS_NNUE_X86)
+        // Compilés pour leur jeu d'instructions seulement : le reste du programme n'en dépend pas
+
+        __attribute__((target("sse4.1"))) inline void updateSse41(
+            std::int16_t* output, const std::int16_t* input, const std::int16_t* const* added, int addedCount,
+            const std::int16_t* const* removed, int removedCount) {
+            for (int i = 0; i < L1; i += 8) {
+                __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                for (int k = 0; k < addedCount; ++k) {
+                    value = _mm_add_epi16(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(added[k] + i)));
+                }
+                for (int k = 0; k < removedCount; ++k) {
+                    value = _mm_sub_epi16(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(removed[k] + i)));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), value);
+            }
+        }
+
+        __attribute__((target("sse4.1"))) inline std::int32_t dotSse41(const std::uint8_t* input,
+                                                                       const std::int8_t* weights, int length) {
+            const __m128i ones = _mm_set1_epi16(1);
+            __m128i sum = _mm_setzero_si128();
+            for (int i = 0; i < length; i += 16) {
+                __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i));
+                // Paires u8 x i8 sommées en int16 (sans saturation : 2 x 127 x 128 < 32768), puis en int32
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(in, w), ones));
+            }
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+            return _mm_cvtsi128_si32(sum);
+        }
+
+        __attribute__((target("sse4.1"))) inline void clipSse41(std::uint8_t* output, const std::int16_t* us,
+                                                                const std::int16_t* them) {
+            const __m128i zero = _mm_setzero_si128();
+            const std::int16_t* halves[2] = {us, them};
+            for (int half = 0; half < 2; ++half) {
+                for (int i = 0; i < L1; i += 16) {
+                    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(halves[half] + i));
+                    __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(halves[half] + i + 8));
+                    __m128i packed = _mm_max_epi8(_mm_packs_epi16(low, high), zero);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + half * L1 + i), packed);
+                }
+            }
+        }
+
+        __attribute__((target("avx2"))) inline void updateAvx2(
+            std::int16_t* output, const std::int16_t* input, const std::int16_t* const* added, int addedCount,
+            const std::int16_t* const* removed, int removedCount) {
+            for (int i = 0; i < L1; i += 16) {
+                __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                for (int k = 0; k < addedCount; ++k) {
+                    value = _mm256_add_epi16(value,
+                                             _mm256_loadu_si256(reinterpret_cast<const __m256i*>(added[k] + i)));
+                }
+                for (int k = 0; k < removedCount; ++k) {
+                    value = _mm256_sub_epi16(value,
+                                             _mm256_loadu_si256(reinterpret_cast<const __m256i*>(removed[k] + i)));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), value);
+            }
+        }
+
+        __attribute__((target("avx2"))) inline std::int32_t dotAvx2(const std::uint8_t* input,
+                                                                    const std::int8_t* weights, int length) {
+            const __m256i ones = _mm256_set1_epi16(1);
+            __m256i sum = _mm256_setzero_si256();
+            for (int i = 0; i < length; i += 32) {
+                __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(in, w), ones));
+            }
+            __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+            return _mm_cvtsi128_si32(half);
+        }
+
+        __attribute__((target("avx2"))) inline void clipAvx2(std::uint8_t* output, const std::int16_t* us,
+                                                            const std::int16_t* them) {
+            const __m256i zero = _mm256_setzero_si256();
+            const std::int16_t* halves[2] = {us, them};
+            for (int half = 0; half < 2; ++half) {
+                for (int i = 0; i < L1; i += 32) {
+                    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(halves[half] + i));
+                    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(halves[half] + i + 16));
+                    // packs travaille par demi-registre de 128 bits : on remet les quatre quarts dans l'ordre
+                    __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(low, high), 0xD8);
+                    packed = _mm256_max_epi8(packed, zero);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + half * L1 + i), packed);
+                }
+            }
+        }
+
+        constexpr Kernels SSE41 = {"SSE4.1", updateSse41, dotSse41, clipSse41};
+        constexpr Kernels AVX2 = {"AVX2", updateAvx2, dotAvx2, clipAvx2};
+#endif
+    }
+
+    /**
+     * Noyaux utilisables sur ce processeur, du plus rapide au plus lent (le scalaire en dernier)
+     */
+    inline std::vector<const Kernels*> availableKernels() {
+        std::vector<const Kernels*> kernels;
+#if defined(CHESS_NNUE_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            kernels.push_back(&detail::AVX2);
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            kernels.push_back(&detail::SSE41);
+        }
+#endif
+        kernels.push_back(&detail::SCALAR);
+        return kernels;
+    }
+
+    /**
+     * Meilleur jeu de noyaux du processeur (déterminé une fois)
+     */
+    inline const Kernels& bestKernels() {
+        static const Kernels* best = availableKernels().front();
+        return *best;
+    }
+
+    /**
+     * Score de la sortie du réseau (centipions, du point de vue de us)
+     */
+    inline int propagate(const Network& network, const Kernels& kernels, const std::int16_t* us,
+                         const std::int16_t* them) {
+        alignas(64) std::uint8_t input[2 * L1];
+        alignas(64) std::uint8_t hidden1[L2];
+        alignas(64) std::uint8_t hidden2[L3];
+
+        kernels.clip(input, us, them);
+        for (int j = 0; j < L2; ++j) {
+            std::int32_t sum = network.l1Bias[j] + kernels.dot(input, network.l1Weights + j * 2 * L1, 2 * L1);
+            hidden1[j] = static_cast<std::uint8_t>(std::clamp(sum >> WEIGHT_SHIFT, 0, CLIP));
+        }
+        for (int j = 0; j < L3; ++j) {
+            std::int32_t sum = network.l2Bias[j] + kernels.dot(hidden1, network.l2Weights + j * L2, L2);
+            hidden2[j] = static_cast<std::uint8_t>(std::clamp(sum >> WEIGHT_SHIFT, 0, CLIP));
+        }
+        std::int32_t output = network.outputBias[0] + kernels.dot(hidden2, network.outputWeights, L3);
+        return output / OUTPUT_SCALE;
+    }
+
+    /**
+     * Fichier de poids projeté en mémoire
+     */
+    class NetworkFile {
+    private:
+        MappedFile file_;
+        Network network_;
+
+    public:
+        /**
+         * @throws std::runtime_error si le fichier est illisible ou n'a pas le format attendu
+         */
+        explicit NetworkFile(const std::string& path) : file_(path), network_() {
+            std::string_view data = file_.view();
+            if (data.size() != FILE_SIZE || std::memcmp(data.data(), MAGIC, sizeof(MAGIC)) != 0) {
+                throw std::runtime_error("Réseau NNUE invalide (format ou taille inattendus) : " + path);
+            }
+            const char* base = data.data();
+            network_.featureBias = reinterpret_cast<const std::int16_t*>(base + FEATURE_BIAS_OFFSET);
+            network_.featureWeights = reinterpret_cast<const std::int16_t*>(base + FEATURE_WEIGHTS_OFFSET);
+            network_.l1Bias = reinterpret_cast<const std::int32_t*>(base + L1_BIAS_OFFSET);
+            network_.l1Weights = reinterpret_cast<const std::int8_t*>(base + L1_WEIGHTS_OFFSET);
+            network_.l2Bias = reinterpret_cast<const std::int32_t*>(base + L2_BIAS_OFFSET);
+            network_.l2Weights = reinterpret_cast<const std::int8_t*>(base + L2_WEIGHTS_OFFSET);
+            network_.outputBias = reinterpret_cast<const std::int32_t*>(base + OUTPUT_BIAS_OFFSET);
+            network_.outputWeights = reinterpret_cast<const std::int8_t*>(base + OUTPUT_WEIGHTS_OFFSET);
+        }
+
+        const Network& network() const { return network_; }
+
+        /**
+         * Écrit un réseau aux poids aléatoires (reproductibles) : sert à vérifier et mesurer
+         * les noyaux en l'absence de réseau entraîné
+         */
+        static void writeRandom(const std::string& path, std::uint32_t seed = 1) {
+            std::vector<char> data(FILE_SIZE, 0);
+            std::memcpy(data.data(), MAGIC, sizeof(MAGIC));
+            std::mt19937 random(seed);
+            auto fill = [&](size_t offset, size_t count, size_t size, int low, int high) {
+                std::uniform_int_distribution<int> distribution(low, high);
+                for (size_t i = 0; i < count; ++i) {
+                    std::int32_t value = distribution(random);
+                    std::memcpy(data.data() + offset + i * size, &value, size);
+                }
+            };
+            fill(FEATURE_BIAS_OFFSET, L1, sizeof(std::int16_t), 0, 64);
+            fill(FEATURE_WEIGHTS_OFFSET, static_cast<size_t>(FEATURES) * L1, sizeof(std::int16_t), -12, 12);
+            fill(L1_BIAS_OFFSET, L2, sizeof(std::int32_t), -2000, 2000);
+            fill(L1_WEIGHTS_OFFSET, L2 * 2 * L1, 1, -16, 16);
+            fill(L2_BIAS_OFFSET, L3, sizeof(std::int32_t), -2000, 2000);
+            fill(L2_WEIGHTS_OFFSET, L3 * L2, 1, -32, 32);
+            fill(OUTPUT_BIAS_OFFSET, 1, sizeof(std::int32_t), -100, 100);
+            fill(OUTPUT_WEIGHTS_OFFSET, L3, 1, -64, 64);
+
+            std::ofstream output(path, std::ios::binary);
+            if (!output.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+                throw std::runtime_error("Impossible d'écrire " + path);
+            }
+        }
+    };
+
+    /**
+     * Accumulateurs des deux points de vue pour une position
+     */
+    struct alignas(64) Accumulator {
+        std::int16_t values[2][L1];
+        bool computed[2];   // Faux quand le roi de ce camp a bougé : à reconstruire
+    };
+
+    /**
+     * Pile d'accumulateurs suivant la recherche : push() avant chaque makeMove, pop() après unmakeMove
+     *
+     * Un coup ne change que deux à quatre colonnes : l'accumulateur suivant est la copie
+     * du précédent, plus les colonnes ajoutées, moins les retirées. Quand un roi bouge, toutes
+     * les caractéristiques de son camp changent : son accumulateur n'est reconstruit qu'au
+     * moment d'évaluer (et reste à reconstruire pour les coups joués d'ici là).
+     */
+    class AccumulatorStack {
+    private:
+        const Network* network_;
+        const Kernels* kernels_;
+        std::vector<Accumulator> stack_;
+        int top_;
+
+    public:
+        static constexpr int MAX_DEPTH = 256;
+
+        AccumulatorStack() : network_(nullptr), kernels_(&bestKernels()), stack_(MAX_DEPTH + 1), top_(0) {}
+
+        void setNetwork(const Network* network) { network_ = network; }
+        const Network* getNetwork() const { return network_; }
+
+        /**
+         * Choisit les noyaux (par défaut le meilleur du processeur)
+         */
+        void setKernels(const Kernels& kernels) { kernels_ = &kernels; }
+
+        /**
+         * Repart d'une position (racine de la recherche) : accumulateurs reconstruits
+         */
+        void reset(const BoardState& state) {
+            top_ = 0;
+            for (Color color : {Color::WHITE, Color::BLACK}) {
+                refresh(state, color, stack_[0]);
+            }
+        }
+
+        /**
+         * Calcule l'accumulateur après le coup
+         * @param before Position avant le coup (appel précédant makeMove)
+         */
+        void push(const BoardState& before, const EngineMove& move) {
+            const Accumulator& previous = stack_[top_];
+            Accumulator& next = stack_[++top_];
+
+            int from = move.getFrom();
+            int to = move.getTo();
+            int moving = before.pieceIndexAt(from);
+            Color mover = BoardState::colorOfIndex(moving);
+            bool kingMove = BoardState::typeOfIndex(moving) == PieceType::KING;
+            int capturedSquare = move.isEnPassant() ? (to ^ 8) : to;
+            int captured = move.isCastling() ? BoardState::NO_PIECE : before.pieceIndexAt(capturedSquare);
+
+            for (Color perspective : {Color::WHITE, Color::BLACK}) {
+                int side = static_cast<int>(perspective);
+                if (!previous.computed[side] || (kingMove && mover == perspective)) {
+                    next.computed[side] = false;
+                    continue;
+                }
+
+                int king = before.getKingSquare(perspective);
+                const std::int16_t* added[2];
+                const std::int16_t* removed[2];
+                int addedCount = 0;
+                int removedCount = 0;
+                if (move.isCastling()) {
+                    // Le roi adverse n'est pas une caractéristique : seule la tour compte
+                    bool kingSide = to > from;
+                    int rook = BoardState::pieceIndex(mover, PieceType::ROOK);
+                    removed[removedCount++] =
+                        network_->column(featureIndex(perspective, king, rook, kingSide ? from + 3 : from - 4));
+                    added[addedCount++] =
+                        network_->column(featureIndex(perspective, king, rook, kingSide ? from + 1 : from - 1));
+                } else if (!kingMove) {
+                    int arriving = move.isPromotion() ? BoardState::pieceIndex(mover, move.getPromotion()) : moving;
+                    removed[removedCount++] = network_->column(featureIndex(perspective, king, moving, from));
+                    added[addedCount++] = network_->column(featureIndex(perspective, king, arriving, to));
+                }
+                if (captured != BoardState::NO_PIECE) {
+                    removed[removedCount++] =
+                        network_->column(featureIndex(perspective, king, captured, capturedSquare));
+                }
+                kernels_->update(next.values[side], previous.values[side], added, addedCount, removed,
+                                 removedCount);
+                next.computed[side] = true;
+            }
+        }
+
+        void pop() {
+            --top_;
+        }
+
+        /**
+         * Évaluation de la position courante (celle du sommet de la pile), du point de vue du camp au trait
+         */
+        int evaluate(const BoardState& state) {
+            Accumulator& accumulator = stack_[top_];
+            for (Color color : {Color::WHITE, Color::BLACK}) {
+                if (!accumulator.computed[static_cast<int>(color)]) {
+                    refresh(state, color, accumulator);
+                }
+            }
+            int us = static_cast<int>(state.getSideToMove());
+            return propagate(*network_, *kernels_, accumulator.values[us], accumulator.values[1 - us]);
+        }
+
+    private:
+        void refresh(const BoardState& state, Color perspective, Accumulator& accumulator) {
+            const std::int16_t* columns[MAX_ACTIVE];
+            int count = 0;
+            int king = state.getKingSquare(perspective);
+            for (int index = 0; index < BoardState::PIECE_COUNT; ++index) {
+                if (BoardState::typeOfIndex(index) == PieceType::KING) {
+                    continue;
+                }
+                Bitboard pieces = state.getPieces(BoardState::colorOfIndex(index), BoardState::typeOfIndex(index));
+                while (pieces && count < MAX_ACTIVE) {
+                    columns[count++] = network_->column(featureIndex(perspective, king, index,
+                                                                     Bitboards::popLsb(pieces)));
+                }
+            }
+            int side = static_cast<int>(perspective);
+            kernels_->update(accumulator.values[side], network_->featureBias, columns, count, nullptr, 0);
+            accumulator.computed[side] = true;
+        }
+    };
+}
+
+#endif // NNUE_HPP
\ No newline at end of file
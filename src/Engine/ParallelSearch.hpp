@@ -0,0 +1,106 @@
+#ifndef PARALLEL_SEARCH_HPP
+#define PARALLEL_SEARCH_HPP
+
+#include "Search.hpp"
+#include "SearchLimits.hpp"
+#include "TranspositionTable.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/Zobrist.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/ThreadPool.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Recherche multi-thread « Lazy SMP »
+ *
+ * Le thread appelant est le thread principal : il applique les limites (temps, nœuds,
+ * profondeur), publie les itérations et choisit le coup. Chaque thread du ThreadPool
+ * lance en parallèle la même recherche depuis la même racine, sans autre communication
+ * que la table de transposition partagée ; comme les assistants sautent des profondeurs
+ * différentes, ils la remplissent d'avance pour le thread principal.
+ */
+class ParallelSearch {
+public:
+    /**
+     * @param table Table partagée par tous les threads (vieillie une fois ici), ou nullptr
+     * @param helpers Threads assistants, ou nullptr pour une recherche sur le seul thread appelant
+     * @param listener Itérations du thread principal ; les nœuds sont ceux de tous les threads
+     * @param network Réseau NNUE partagé en lecture par tous les threads, ou nullptr pour l'évaluation classique
+     * @return Le meilleur coup, ou EngineMove::none() s'il n'y a aucun coup légal
+     */
+    static EngineMove run(const BoardState& root, const std::vector<Zobrist::Key>& history,
+                          const SearchLimits& limits, const std::atomic<bool>& stop,
+                          TranspositionTable* table, ThreadPool* helpers, std::int64_t overhead = 0,
+                          const Search::Listener& listener = Search::Listener(),
+                          const Nnue::Network* network = nullptr) {
+        if (table) {
+            table->newSearch();
+        }
+
+        Search main(root, history, limits, stop, table, overhead);
+        main.setNetwork(network);
+        if (!helpers || helpers->size() == 0) {
+            return main.run(listener);
+        }
+
+        // Les assistants ne connaissent que la profondeur : le reste est l'affaire du thread principal
+        SearchLimits helperLimits;
+        helperLimits.depth = limits.depth;
+        std::atomic<bool> helpersStop(false);
+        std::vector<std::unique_ptr<Search>> searches;
+        for (size_t i = 0; i < helpers->size(); ++i) {
+            searches.push_back(std::make_unique<Search>(root, history, helperLimits, helpersStop, table));
+            searches.back()->setThreadIndex(static_cast<int>(i) + 1);
+            searches.back()->setNetwork(network);
+            Search* search = searches.back().get();
+            helpers->submit([search] { search->run(); });
+        }
+
+        EngineMove best = main.run([&](const SearchReport& report) {
+            if (!listener) {
+                return;
+            }
+            SearchReport total = report;
+            total.nodes = totalNodes(main, searches);
+            listener(total);
+        });
+
+        helpersStop = true;
+        helpers->wait();
+
+        // Un assistant allé plus loin que le thread principal, avec un meilleur score, l'emporte
+        const Search* chosen = &main;
+        for (const std::unique_ptr<Search>& search : searches) {
+            const SearchReport& candidate = search->getLastReport();
+            const SearchReport& current = chosen->getLastReport();
+            if (!candidate.pv.empty() && candidate.depth > current.depth && candidate.score > current.score) {
+                chosen = search.get();
+            }
+        }
+        if (chosen != &main) {
+            best = chosen->getLastReport().pv[0];
+            if (listener) {
+                SearchReport total = chosen->getLastReport();
+                total.nodes = totalNodes(main, searches);
+                total.seconds = main.getLastReport().seconds;
+                total.hashfull = table ? table->hashfull() : 0;
+                listener(total);
+            }
+        }
+        return best;
+    }
+
+private:
+    static std::uint64_t totalNodes(const Search& main, const std::vector<std::unique_ptr<Search>>& searches) {
+        std::uint64_t nodes = main.getNodes();
+        for (const std::unique_ptr<Search>& search : searches) {
+            nodes += search->getNodes();
+        }
+        return nodes;
+    }
+};
+
+#endif // PARALLEL_SEARCH_HPP
\ No newline at end of file
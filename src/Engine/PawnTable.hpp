@@ -0,0 +1,222 @@
+#ifndef PAWN_TABLE_HPP
+#define PAWN_TABLE_HPP
+
+#include "../Core/Attacks.hpp"
+#include "../Core/Bitboard.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/Zobrist.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/PieceType.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * Résultat de l'analyse d'une structure de pions
+ */
+struct PawnEntry {
+    Zobrist::Key key;
+    Bitboard passed[2];          // Pions passés de chaque camp
+    std::int16_t mg;             // Termes de structure, du point de vue des blancs
+    std::int16_t eg;
+    std::int16_t shelter[2];     // Abri de pions du roi de chaque camp (milieu de partie)...
+    std::int8_t kingSquare[2];   // ... calculé pour cette case du roi (NO_SQUARE : pas encore)
+};
+
+/**
+ * Cache des termes de structure de pions, propre à chaque thread de recherche
+ *
+ * La structure de pions change rarement d'un nœud à l'autre : l'analyse (pions doublés,
+ * isolés, arriérés, passés) est indexée par la clé de Zobrist des seuls pions et n'est
+ * refaite qu'en cas d'échec. L'abri du roi dépend aussi de la case du roi : il est
+ * mémorisé dans l'entrée pour la dernière case rencontrée de chaque roi.
+ * Sans partage entre threads, la table n'a besoin d'aucune synchronisation.
+ */
+class PawnTable {
+private:
+    std::unique_ptr<PawnEntry[]> entries_;
+    size_t mask_;
+    std::uint64_t probes_;
+    std::uint64_t hits_;
+
+    // Bonus du pion passé selon sa rangée relative (rangée 2 à 7)
+    static constexpr int PASSED_MG[8] = {0, 0, 5, 10, 20, 35, 60, 0};
+    static constexpr int PASSED_EG[8] = {0, 10, 15, 25, 40, 70, 110, 0};
+    static constexpr int DOUBLED_MG = -10;
+    static constexpr int DOUBLED_EG = -20;
+    static constexpr int ISOLATED_MG = -10;
+    static constexpr int ISOLATED_EG = -15;
+    static constexpr int BACKWARD_MG = -8;
+    static constexpr int BACKWARD_EG = -10;
+    // Abri : pion devant le roi sur sa deuxième ou troisième rangée, ou colonne dégarnie
+    static constexpr int SHIELD_NEAR = 15;
+    static constexpr int SHIELD_FAR = 8;
+    static constexpr int SHIELD_MISSING = -15;
+
+public:
+    /**
+     * Constructeur
+     * @param entries Nombre d'entrées (arrondi à la puissance de deux inférieure)
+     */
+    explicit PawnTable(size_t entries = 1 << 14) : mask_(0), probes_(0), hits_(0) {
+        size_t size = 1;
+        while (size * 2 <= entries) {
+            size *= 2;
+        }
+        entries_.reset(new PawnEntry[size]);
+        mask_ = size - 1;
+        clear();
+    }
+
+    void clear() {
+        for (size_t i = 0; i <= mask_; ++i) {
+            entries_[i] = PawnEntry{0, {0, 0}, 0, 0, {0, 0}, {Bitboards::NO_SQUARE, Bitboards::NO_SQUARE}};
+        }
+        probes_ = 0;
+        hits_ = 0;
+    }
+
+    /**
+     * Entrée de la structure de pions de la position, analysée si elle n'est pas en cache
+     * (une position sans pion a la clé 0, qui correspond aussi à une entrée vide : c'est sans danger)
+     */
+    PawnEntry& probe(const BoardState& state) {
+        Zobrist::Key key = state.getPawnHash();
+        PawnEntry& entry = entries_[key & mask_];
+        ++probes_;
+        if (entry.key == key) {
+            ++hits_;
+            return entry;
+        }
+        analyse(state, entry);
+        entry.key = key;
+        return entry;
+    }
+
+    /**
+     * Abri de pions du roi d'un camp, recalculé seulement quand ce roi a changé de case
+     */
+    static int shelter(const BoardState& state, PawnEntry& entry, Color color) {
+        int side = static_cast<int>(color);
+        int king = state.getKingSquare(color);
+        if (entry.kingSquare[side] != king) {
+            entry.kingSquare[side] = static_cast<std::int8_t>(king);
+            entry.shelter[side] = static_cast<std::int16_t>(computeShelter(state, color, king));
+        }
+        return entry.shelter[side];
+    }
+
+    std::uint64_t getProbes() const { return probes_; }
+    std::uint64_t getHits() const { return hits_; }
+
+    double hitRate() const {
+        return probes_ > 0 ? static_cast<double>(hits_) / static_cast<double>(probes_) : 0.0;
+    }
+
+    /**
+     * Cases devant un pion, sur sa colonne et les deux voisines : aucun pion adverse ne doit s'y trouver
+     * pour qu'il soit passé
+     */
+    static Bitboard passedMask(Color color, int square) {
+        Bitboard file = Bitboards::FILE_A << Bitboards::fileOf(square);
+        return forwardRanks(color, square) & (file | adjacentFiles(square));
+    }
+
+private:
+    static Bitboard adjacentFiles(int square) {
+        Bitboard file = Bitboards::FILE_A << Bitboards::fileOf(square);
+        return ((file << 1) & ~Bitboards::FILE_A) | ((file >> 1) & ~Bitboards::FILE_H);
+    }
+
+    /**
+     * Rangées strictement devant une case, dans le sens de marche d'un camp
+     */
+    static Bitboard forwardRanks(Color color, int square) {
+        int rank = Bitboards::rankOf(square);
+        if (color == Color::WHITE) {
+            return rank == 7 ? Bitboards::EMPTY : ~Bitboards::EMPTY << (8 * (rank + 1));
+        }
+        return (Bitboards::squareBB(8 * rank)) - 1;
+    }
+
+    static void analyse(const BoardState& state, PawnEntry& entry) {
+        int mg = 0;
+        int eg = 0;
+        for (Color color : {Color::WHITE, Color::BLACK}) {
+            Color them = oppositeColor(color);
+            Bitboard ours = state.getPieces(color, PieceType::PAWN);
+            Bitboard theirs = state.getPieces(them, PieceType::PAWN);
+            int sign = color == Color::WHITE ? 1 : -1;
+            int up = color == Color::WHITE ? 8 : -8;
+            Bitboard passed = Bitboards::EMPTY;
+
+            Bitboard pawns = ours;
+            while (pawns) {
+                int square = Bitboards::popLsb(pawns);
+                Bitboard file = Bitboards::FILE_A << Bitboards::fileOf(square);
+                Bitboard adjacent = adjacentFiles(square);
+                Bitboard front = forwardRanks(color, square);
+                int rank = color == Color::WHITE ? Bitboards::rankOf(square) : 7 - Bitboards::rankOf(square);
+
+                // Le pion de derrière porte la pénalité du doublé
+                bool doubled = (ours & file & front) != 0;
+                if (doubled) {
+                    mg += sign * DOUBLED_MG;
+                    eg += sign * DOUBLED_EG;
+                }
+
+                if (!(ours & adjacent)) {
+                    mg += sign * ISOLATED_MG;
+                    eg += sign * ISOLATED_EG;
+                } else if (!(ours & adjacent & ~front) &&
+                           (Attacks::pawnAttacks(color, square + up) & theirs)) {
+                    // Arriéré : aucun voisin à sa hauteur ou derrière, et sa case d'avance est contrôlée
+                    mg += sign * BACKWARD_MG;
+                    eg += sign * BACKWARD_EG;
+                }
+
+                if (!doubled && !(theirs & passedMask(color, square))) {
+                    passed |= Bitboards::squareBB(square);
+                    mg += sign * PASSED_MG[rank];
+                    eg += sign * PASSED_EG[rank];
+                }
+            }
+            entry.passed[static_cast<int>(color)] = passed;
+        }
+        entry.mg = static_cast<std::int16_t>(mg);
+        entry.eg = static_cast<std::int16_t>(eg);
+        entry.kingSquare[0] = Bitboards::NO_SQUARE;
+        entry.kingSquare[1] = Bitboards::NO_SQUARE;
+    }
+
+    /**
+     * Pions du camp devant son roi, sur la colonne du roi et ses voisines
+     */
+    static int computeShelter(const BoardState& state, Color color, int king) {
+        if (king == Bitboards::NO_SQUARE) {
+            return 0;
+        }
+        Bitboard ours = state.getPieces(color, PieceType::PAWN);
+        int center = std::min(std::max(Bitboards::fileOf(king), 1), 6);
+        int kingRank = color == Color::WHITE ? Bitboards::rankOf(king) : 7 - Bitboards::rankOf(king);
+        int score = 0;
+        for (int fileIndex = center - 1; fileIndex <= center + 1; ++fileIndex) {
+            Bitboard shield = ours & (Bitboards::FILE_A << fileIndex) & forwardRanks(color, king);
+            if (!shield) {
+                score += SHIELD_MISSING;
+                continue;
+            }
+            int nearest = color == Color::WHITE ? Bitboards::lsb(shield) : Bitboards::msb(shield);
+            int rank = color == Color::WHITE ? Bitboards::rankOf(nearest) : 7 - Bitboards::rankOf(nearest);
+            if (rank - kingRank == 1) {
+                score += SHIELD_NEAR;
+            } else if (rank - kingRank == 2) {
+                score += SHIELD_FAR;
+            }
+        }
+        return score;
+    }
+};
+
+#endif // PAWN_TABLE_HPP
\ No newline at end of file
@@ -0,0 +1,152 @@
+#ifndef PERFT_HPP
+#define PERFT_HPP
+
+#include "../Core/BoardState.hpp"
+#include "../Core/MoveGenerator.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/MoveList.hpp"
+#include "../Utils/ThreadPool.hpp"
+#include "PerftCache.hpp"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Nombre de feuilles sous un coup de la racine (sortie "divide")
+ */
+struct PerftEntry {
+    EngineMove move;
+    std::uint64_t nodes;
+};
+
+/**
+ * Résultat d'un perft : total, détail par coup racine et débit
+ */
+struct PerftResult {
+    std::uint64_t nodes = 0;
+    double seconds = 0.0;
+    std::vector<PerftEntry> divide;
+    std::uint64_t cacheProbes = 0;
+    std::uint64_t cacheHits = 0;
+
+    double nodesPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(nodes) / seconds : 0.0;
+    }
+
+    double cacheHitRate() const {
+        return cacheProbes > 0 ? static_cast<double>(cacheHits) / static_cast<double>(cacheProbes) : 0.0;
+    }
+};
+
+/**
+ * Compte les positions feuilles jusqu'à une profondeur donnée
+ * Référence de correction et de débit pour le générateur de coups
+ */
+class Perft {
+public:
+    /**
+     * Perft séquentiel avec comptage groupé au dernier niveau
+     * (la taille de la liste de coups suffit, les feuilles ne sont pas jouées)
+     */
+    static std::uint64_t count(BoardState& state, int depth) {
+        if (depth == 0) {
+            return 1;
+        }
+
+        MoveList moves;
+        MoveGenerator::generateLegalMoves(state, moves);
+        if (depth == 1) {
+            return static_cast<std::uint64_t>(moves.size());
+        }
+
+        std::uint64_t nodes = 0;
+        UndoInfo undo;
+        for (const EngineMove& move : moves) {
+            state.makeMove(move, undo);
+            nodes += count(state, depth - 1);
+            state.unmakeMove(move, undo);
+        }
+        return nodes;
+    }
+
+    /**
+     * Perft mémoïsé : les sous-arbres déjà comptés sont lus dans le cache
+     * Le dernier niveau reste en comptage groupé (moins cher qu'un sondage).
+     */
+    static std::uint64_t countHashed(BoardState& state, int depth, PerftCache& cache,
+                                     std::uint64_t& probes, std::uint64_t& hits) {
+        if (depth <= 1) {
+            return count(state, depth);
+        }
+
+        std::uint64_t nodes = 0;
+        ++probes;
+        if (cache.probe(state.getHash(), depth, nodes)) {
+            ++hits;
+            return nodes;
+        }
+
+        MoveList moves;
+        MoveGenerator::generateLegalMoves(state, moves);
+        UndoInfo undo;
+        for (const EngineMove& move : moves) {
+            state.makeMove(move, undo);
+            nodes += countHashed(state, depth - 1, cache, probes, hits);
+            state.unmakeMove(move, undo);
+        }
+
+        cache.store(state.getHash(), depth, nodes);
+        return nodes;
+    }
+
+    /**
+     * Perft complet avec détail par coup racine
+     * Les coups racine sont répartis entre les threads d'un ThreadPool,
+     * chaque tâche travaillant sur sa propre copie de la position.
+     * @param threads Nombre de threads (0 = tous les cœurs)
+     * @param cache Cache partagé par tous les threads, ou nullptr pour un perft sans mémoïsation
+     */
+    static PerftResult run(const BoardState& state, int depth, size_t threads = 1,
+                           PerftCache* cache = nullptr) {
+        auto start = std::chrono::steady_clock::now();
+        PerftResult result;
+
+        MoveList moves;
+        MoveGenerator::generateLegalMoves(state, moves);
+
+        if (depth <= 0) {
+            result.nodes = 1;
+        } else {
+            size_t rootCount = static_cast<size_t>(moves.size());
+            result.divide.resize(rootCount);
+            // Statistiques propres à chaque tâche : aucun compteur partagé pendant le calcul
+            std::vector<std::uint64_t> probes(rootCount, 0);
+            std::vector<std::uint64_t> hits(rootCount, 0);
+            {
+                ThreadPool pool(threads);
+                for (size_t i = 0; i < rootCount; ++i) {
+                    result.divide[i].move = moves[static_cast<int>(i)];
+                    pool.submit([&, i] {
+                        PerftEntry& entry = result.divide[i];
+                        BoardState child = state;
+                        UndoInfo undo;
+                        child.makeMove(entry.move, undo);
+                        entry.nodes = cache ? countHashed(child, depth - 1, *cache, probes[i], hits[i])
+                                            : count(child, depth - 1);
+                    });
+                }
+                pool.wait();
+            }
+            for (size_t i = 0; i < rootCount; ++i) {
+                result.nodes += result.divide[i].nodes;
+                result.cacheProbes += probes[i];
+                result.cacheHits += hits[i];
+            }
+        }
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+};
+
+#endif // PERFT_HPP
\ No newline at end of file
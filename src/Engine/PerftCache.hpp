@@ -0,0 +1,97 @@
+#ifndef PERFT_CACHE_HPP
+#define PERFT_CACHE_HPP
+
+#include "../Core/Zobrist.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * Table de mémoïsation (clé de Zobrist, profondeur) -> nombre de nœuds pour le perft
+ *
+ * Partagée sans verrou entre les threads : chaque entrée stocke la donnée et
+ * (clé XOR donnée). Une lecture concurrente déchirée ne vérifie plus la clé
+ * et est simplement traitée comme un échec de sondage.
+ */
+class PerftCache {
+private:
+    struct Entry {
+        std::atomic<std::uint64_t> check;   // clé XOR donnée
+        std::atomic<std::uint64_t> data;    // nœuds (56 bits) | profondeur (8 bits)
+    };
+
+    // Deux entrées par seau : l'une garde la plus profonde, l'autre est toujours remplacée
+    static constexpr size_t BUCKET_SIZE = 2;
+    static constexpr int DEPTH_BITS = 8;
+
+    std::unique_ptr<Entry[]> entries_;
+    size_t bucketMask_;
+
+public:
+    /**
+     * Constructeur
+     * @param megabytes Taille de la table en Mo (arrondie à la puissance de deux inférieure)
+     */
+    explicit PerftCache(size_t megabytes) {
+        size_t bytes = (megabytes == 0 ? 1 : megabytes) * 1024 * 1024;
+        size_t buckets = 1;
+        while (buckets * 2 * BUCKET_SIZE * sizeof(Entry) <= bytes) {
+            buckets *= 2;
+        }
+        entries_.reset(new Entry[buckets * BUCKET_SIZE]);
+        bucketMask_ = buckets - 1;
+        clear();
+    }
+
+    void clear() {
+        for (size_t i = 0; i <= bucketMask_; ++i) {
+            for (size_t slot = 0; slot < BUCKET_SIZE; ++slot) {
+                Entry& entry = entries_[i * BUCKET_SIZE + slot];
+                entry.check.store(0, std::memory_order_relaxed);
+                entry.data.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t sizeInBytes() const {
+        return (bucketMask_ + 1) * BUCKET_SIZE * sizeof(Entry);
+    }
+
+    /**
+     * Cherche le nombre de nœuds d'une position à une profondeur donnée
+     * @return true si l'entrée est trouvée (nodes est alors rempli)
+     */
+    bool probe(Zobrist::Key key, int depth, std::uint64_t& nodes) const {
+        const Entry* bucket = &entries_[(key & bucketMask_) * BUCKET_SIZE];
+        for (size_t slot = 0; slot < BUCKET_SIZE; ++slot) {
+            std::uint64_t data = bucket[slot].data.load(std::memory_order_relaxed);
+            std::uint64_t check = bucket[slot].check.load(std::memory_order_relaxed);
+            if ((check ^ data) == key && unpackDepth(data) == depth) {
+                nodes = data >> DEPTH_BITS;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Enregistre un résultat
+     */
+    void store(Zobrist::Key key, int depth, std::uint64_t nodes) {
+        Entry* bucket = &entries_[(key & bucketMask_) * BUCKET_SIZE];
+        std::uint64_t data = (nodes << DEPTH_BITS) | static_cast<std::uint64_t>(depth);
+
+        std::uint64_t deepData = bucket[0].data.load(std::memory_order_relaxed);
+        Entry& target = depth >= unpackDepth(deepData) ? bucket[0] : bucket[1];
+        target.data.store(data, std::memory_order_relaxed);
+        target.check.store(key ^ data, std::memory_order_relaxed);
+    }
+
+private:
+    static int unpackDepth(std::uint64_t data) {
+        return static_cast<int>(data & ((1u << DEPTH_BITS) - 1));
+    }
+};
+
+#endif // PERFT_CACHE_HPP
\ No newline at end of file
@@ -0,0 +1,591 @@
+#ifndef SEARCH_HPP
+#define SEARCH_HPP
+
+#include "Evaluation.hpp"
+#include "MoveHistory.hpp"
+#include "MovePicker.hpp"
+#include "SearchLimits.hpp"
+#include "StaticExchange.hpp"
+#include "TranspositionTable.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/MoveGenerator.hpp"
+#include "../Core/PieceCode.hpp"
+#include "../Core/Zobrist.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/MoveList.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * Bilan d'une itération de la recherche
+ */
+struct SearchReport {
+    int depth = 0;
+    int score = 0;                  // Centipions, du point de vue du camp au trait
+    std::uint64_t nodes = 0;
+    int hashfull = 0;               // Remplissage de la table de transposition (pour mille)
+    double seconds = 0.0;
+    std::vector<EngineMove> pv;
+    std::uint64_t cutoffs = 0;            // Coupures bêta depuis le début de la recherche
+    std::uint64_t firstMoveCutoffs = 0;   // ... obtenues dès le premier coup essayé
+    double pawnHitRate = 0.0;             // Succès de la table de pions (0 à 1)
+
+    double nodesPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(nodes) / seconds : 0.0;
+    }
+
+    /**
+     * Part des coupures obtenues au premier coup : mesure la qualité de l'ordre des coups
+     */
+    double firstMoveCutoffRate() const {
+        return cutoffs > 0 ? static_cast<double>(firstMoveCutoffs) / static_cast<double>(cutoffs) : 0.0;
+    }
+};
+
+/**
+ * Recherche alpha-bêta (negamax, PVS) par approfondissement itératif
+ * Un objet par recherche : il copie la position racine et l'explore par makeMove/unmakeMove.
+ * Le drapeau d'arrêt est lu à chaque nœud, la pendule tous les CLOCK_CHECK_INTERVAL nœuds.
+ * La table de transposition n'est pas vieillie ici : ParallelSearch le fait une fois pour tous les threads.
+ */
+class Search {
+public:
+    static constexpr int MAX_PLY = 128;
+    static constexpr int INFINITE_SCORE = 32000;
+    static constexpr int MATE_SCORE = 31000;
+    // Au-delà, le score annonce un mat en au plus MAX_PLY demi-coups
+    static constexpr int MATE_BOUND = MATE_SCORE - MAX_PLY;
+
+    using Listener = std::function<void(const SearchReport&)>;
+
+private:
+    static constexpr std::uint64_t CLOCK_CHECK_INTERVAL = 1024;
+    static constexpr int ASPIRATION_WINDOW = 25;
+    static constexpr int ASPIRATION_MIN_DEPTH = 4;
+    // Marge du delta pruning : une capture qui laisse le score si loin sous alpha est ignorée
+    static constexpr int DELTA_MARGIN = 200;
+    // Coups calmes mémorisés par nœud pour le malus d'historique
+    static constexpr int MAX_QUIETS_TRIED = 64;
+
+    // Lazy SMP : chaque assistant saute certaines profondeurs selon son rang,
+    // pour que les threads ne parcourent pas tous le même arbre au même moment
+    static constexpr int SKIP_PATTERNS = 20;
+    static constexpr int SKIP_SIZE[SKIP_PATTERNS] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+    static constexpr int SKIP_PHASE[SKIP_PATTERNS] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+    BoardState state_;
+    // Clés des positions déjà jouées puis de la branche en cours (répétitions)
+    std::vector<Zobrist::Key> keys_;
+    SearchLimits limits_;
+    const std::atomic<bool>& stop_;
+    TranspositionTable* table_;
+    std::chrono::steady_clock::time_point start_;
+    std::int64_t softLimit_;
+    std::int64_t hardLimit_;
+    // Lu par le thread principal pendant la recherche (débit total en Lazy SMP)
+    std::atomic<std::uint64_t> nodes_;
+    bool aborted_;
+    int threadIndex_;
+    SearchReport lastReport_;
+
+    // Variation principale : pv_[ply] est la meilleure suite trouvée à partir de ce demi-coup
+    EngineMove pv_[MAX_PLY][MAX_PLY];
+    int pvLength_[MAX_PLY];
+    EngineMove previousPv_[MAX_PLY];
+    int previousPvLength_;
+    // Coups joués depuis la racine dans la branche en cours, et la pièce qui les a joués
+    EngineMove path_[MAX_PLY];
+    int movedPiece_[MAX_PLY];
+
+    // Ordre des coups : historiques (sur le tas, plus d'un Mo) et coups tueurs par demi-coup
+    std::unique_ptr<MoveHistory> history_;
+    EngineMove killers_[MAX_PLY][2];
+    std::uint64_t cutoffs_;
+    std::uint64_t firstMoveCutoffs_;
+
+    // Évaluation, avec sa table de pions (sur le tas, un demi-Mo)
+    std::unique_ptr<Evaluator> evaluator_;
+
+public:
+    /**
+     * @param history Clés des positions précédant la racine depuis le dernier coup irréversible
+     * @param table Table de transposition (éventuellement partagée), ou nullptr
+     * @param overhead Marge de temps réservée à l'interface (ms)
+     */
+    Search(const BoardState& root, const std::vector<Zobrist::Key>& history, const SearchLimits& limits,
+           const std::atomic<bool>& stop, TranspositionTable* table = nullptr, std::int64_t overhead = 0)
+        : state_(root), keys_(history), limits_(limits), stop_(stop), table_(table), softLimit_(0), hardLimit_(0),
+          nodes_(0), aborted_(false), threadIndex_(0), pvLength_{}, previousPvLength_(0),
+          history_(std::make_unique<MoveHistory>()), cutoffs_(0), firstMoveCutoffs_(0),
+          evaluator_(std::make_unique<Evaluator>()) {
+        hardLimit_ = limits.allocatedTime(root.getSideToMove(), overhead);
+        // Avec une pendule, une itération commencée après la moitié du budget finit rarement à temps
+        softLimit_ = limits.moveTime > 0 ? hardLimit_ : hardLimit_ / 2;
+        keys_.reserve(keys_.size() + MAX_PLY);
+    }
+
+    /**
+     * Lance la recherche
+     * Chaque itération part d'une fenêtre d'aspiration centrée sur le score précédent,
+     * élargie tant que le résultat en sort.
+     * @param listener Appelé après chaque itération terminée
+     * @return Le meilleur coup, ou EngineMove::none() s'il n'y a aucun coup légal
+     */
+    EngineMove run(const Listener& listener = Listener()) {
+        start_ = std::chrono::steady_clock::now();
+        nodes_.store(0, std::memory_order_relaxed);
+        aborted_ = false;
+        previousPvLength_ = 0;
+        lastReport_ = SearchReport();
+        cutoffs_ = 0;
+        firstMoveCutoffs_ = 0;
+        evaluator_->reset(state_);
+        for (EngineMove (&killers)[2] : killers_) {
+            killers[0] = EngineMove::none();
+            killers[1] = EngineMove::none();
+        }
+
+        MoveList rootMoves;
+        MoveGenerator::generateLegalMoves(state_, rootMoves);
+        if (rootMoves.empty()) {
+            return EngineMove::none();
+        }
+
+        EngineMove bestMove = rootMoves[0];
+        int score = 0;
+        int maxDepth = limits_.depth > 0 ? std::min(limits_.depth, MAX_PLY - 1) : MAX_PLY - 1;
+
+        for (int depth = 1; depth <= maxDepth; ++depth) {
+            if (threadIndex_ > 0) {
+                int pattern = (threadIndex_ - 1) % SKIP_PATTERNS;
+                if (((depth + SKIP_PHASE[pattern]) / SKIP_SIZE[pattern]) % 2 != 0) {
+                    continue;
+                }
+            }
+
+            int delta = ASPIRATION_WINDOW;
+            int alpha = -INFINITE_SCORE;
+            int beta = INFINITE_SCORE;
+            if (depth >= ASPIRATION_MIN_DEPTH) {
+                alpha = std::max(score - delta, -INFINITE_SCORE);
+                beta = std::min(score + delta, INFINITE_SCORE);
+            }
+
+            int result = 0;
+            while (true) {
+                result = negamax(depth, alpha, beta, 0);
+                if (aborted_) {
+                    break;
+                }
+                if (result <= alpha) {
+                    alpha = std::max(result - delta, -INFINITE_SCORE);
+                } else if (result >= beta) {
+                    beta = std::min(result + delta, INFINITE_SCORE);
+                } else {
+                    break;
+                }
+                delta *= 2;
+            }
+
+            // Une itération interrompue est abandonnée : on garde le résultat de la précédente
+            if (aborted_) {
+                break;
+            }
+            score = result;
+            previousPvLength_ = pvLength_[0];
+            std::copy(pv_[0], pv_[0] + previousPvLength_, previousPv_);
+            bestMove = previousPv_[0];
+
+            lastReport_.depth = depth;
+            lastReport_.score = score;
+            lastReport_.nodes = getNodes();
+            lastReport_.seconds = elapsedSeconds();
+            lastReport_.pv.assign(previousPv_, previousPv_ + previousPvLength_);
+            lastReport_.cutoffs = cutoffs_;
+            lastReport_.firstMoveCutoffs = firstMoveCutoffs_;
+            lastReport_.pawnHitRate = evaluator_->getPawnTable().hitRate();
+            if (listener) {
+                lastReport_.hashfull = table_ ? table_->hashfull() : 0;
+                listener(lastReport_);
+            }
+
+            // Un mat trouvé ne deviendra pas plus court en cherchant plus loin
+            if (std::abs(score) >= MATE_BOUND && MATE_SCORE - std::abs(score) <= depth && !limits_.infinite) {
+                break;
+            }
+            if (softLimit_ > 0 && elapsedMilliseconds() >= softLimit_) {
+                break;
+            }
+        }
+        return bestMove;
+    }
+
+    std::uint64_t getNodes() const { return nodes_.load(std::memory_order_relaxed); }
+
+    /**
+     * Bilan de la dernière itération terminée (profondeur 0 si aucune)
+     */
+    const SearchReport& getLastReport() const { return lastReport_; }
+
+    /**
+     * Rang du thread en Lazy SMP : 0 pour le thread principal, qui seul applique les limites de temps
+     */
+    void setThreadIndex(int index) {
+        threadIndex_ = index;
+        if (index > 0) {
+            softLimit_ = 0;
+            hardLimit_ = 0;
+        }
+    }
+
+    /**
+     * Évalue avec un réseau NNUE (nullptr : évaluation classique), qui doit survivre à la recherche
+     */
+    void setNetwork(const Nnue::Network* network) {
+        evaluator_->setNetwork(network);
+    }
+
+
+private:
+    /**
+     * Recherche à variation principale (PVS)
+     * Le premier coup est cherché avec la fenêtre complète, les suivants avec une fenêtre
+     * nulle qui ne fait que prouver qu'ils sont moins bons ; seuls ceux qui la dépassent
+     * sont recherchés à nouveau. Tant que la branche suit la variation principale de
+     * l'itération précédente, son coup est essayé en premier.
+     */
+    int negamax(int depth, int alpha, int beta, int ply) {
+        if (depth <= 0) {
+            return quiescence(alpha, beta, ply);
+        }
+        pvLength_[ply] = 0;
+        if (shouldStop()) {
+            aborted_ = true;
+            return 0;
+        }
+        nodes_.store(nodes_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        if (ply > 0 && isDraw()) {
+            return 0;
+        }
+        if (ply >= MAX_PLY - 1) {
+            return evaluator_->evaluate(state_);
+        }
+
+        // Table de transposition : coupure immédiate hors variation principale
+        bool pvNode = beta - alpha > 1;
+        Zobrist::Key key = state_.getHash();
+        TableEntry entry;
+        bool found = table_ && table_->probe(key, entry);
+        EngineMove hashMove = found ? entry.move : EngineMove::none();
+        if (found && !pvNode && entry.depth >= depth) {
+            int score = scoreFromTable(entry.score, ply);
+            if (entry.bound == Bound::EXACT || (entry.bound == Bound::LOWER && score >= beta) ||
+                (entry.bound == Bound::UPPER && score <= alpha)) {
+                return score;
+            }
+        }
+
+        // Premier coup : celui de la variation principale précédente, sinon celui de la table
+        EngineMove firstMove = ply < previousPvLength_ && isOnPreviousPv(ply) ? previousPv_[ply] : hashMove;
+        EngineMove counterMove = EngineMove::none();
+        if (ply > 0 && movedPiece_[ply - 1] != BoardState::NO_PIECE) {
+            counterMove = history_->counterMoves[movedPiece_[ply - 1]][path_[ply - 1].getTo()];
+        }
+        MovePicker picker(state_, *history_, firstMove, killers_[ply][0], killers_[ply][1], counterMove,
+                          continuationAt(ply - 1), continuationAt(ply - 2));
+
+        int originalAlpha = alpha;
+        EngineMove bestMove = EngineMove::none();
+        EngineMove quietsTried[MAX_QUIETS_TRIED];
+        int quietCount = 0;
+        int moveCount = 0;
+        UndoInfo undo;
+        EngineMove move;
+        while (!(move = picker.next()).isNone()) {
+            bool quiet = MovePicker::isQuiet(state_, move);
+            movedPiece_[ply] = state_.pieceIndexAt(move.getFrom());
+            path_[ply] = move;
+            ++moveCount;
+
+            keys_.push_back(state_.getHash());
+            evaluator_->push(state_, move);
+            state_.makeMove(move, undo);
+            if (table_) {
+                table_->prefetch(state_.getHash());
+            }
+
+            int score;
+            if (moveCount == 1) {
+                score = -negamax(depth - 1, -beta, -alpha, ply + 1);
+            } else {
+                score = -negamax(depth - 1, -alpha - 1, -alpha, ply + 1);
+                if (score > alpha && score < beta && !aborted_) {
+                    score = -negamax(depth - 1, -beta, -alpha, ply + 1);
+                }
+            }
+
+            state_.unmakeMove(move, undo);
+            evaluator_->pop();
+            keys_.pop_back();
+
+            if (aborted_) {
+                return 0;
+            }
+            if (score > alpha) {
+                alpha = score;
+                bestMove = move;
+                updatePv(ply, move);
+                if (alpha >= beta) {
+                    ++cutoffs_;
+                    firstMoveCutoffs_ += moveCount == 1;
+                    if (quiet) {
+                        updateQuietHistory(ply, depth, move, quietsTried, quietCount);
+                    }
+                    break;
+                }
+            }
+            if (quiet && quietCount < MAX_QUIETS_TRIED) {
+                quietsTried[quietCount++] = move;
+            }
+        }
+
+        if (moveCount == 0) {
+            // Mat (le plus rapide est préféré) ou pat
+            return state_.getCheckers() ? -MATE_SCORE + ply : 0;
+        }
+
+        if (table_) {
+            Bound bound = alpha >= beta ? Bound::LOWER : alpha > originalAlpha ? Bound::EXACT : Bound::UPPER;
+            table_->store(key, bestMove, scoreToTable(alpha, ply), 0, depth, bound);
+        }
+        return alpha;
+    }
+
+    /**
+     * Recherche de repos : prolonge les feuilles par les captures et promotions jusqu'à une
+     * position calme, pour ne pas évaluer au milieu d'un échange (effet d'horizon).
+     * Hors échec, le camp au trait peut refuser toutes les captures (évaluation statique) ;
+     * les captures perdantes selon la SEE sont écartées par le sélecteur de coups, et celles
+     * qui ne peuvent pas ramener le score au-dessus d'alpha (delta pruning) sont ignorées.
+     * En échec, toutes les parades sont examinées et leur absence signifie le mat.
+     */
+    int quiescence(int alpha, int beta, int ply) {
+        pvLength_[ply] = 0;
+        if (shouldStop()) {
+            aborted_ = true;
+            return 0;
+        }
+        nodes_.store(nodes_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        if (isDraw()) {
+            return 0;
+        }
+        if (ply >= MAX_PLY - 1) {
+            return evaluator_->evaluate(state_);
+        }
+
+        bool inCheck = state_.getCheckers() != 0;
+        int standPat = -INFINITE_SCORE;
+        if (!inCheck) {
+            standPat = evaluator_->evaluate(state_);
+            if (standPat >= beta) {
+                return standPat;
+            }
+            alpha = std::max(alpha, standPat);
+        }
+
+        bool pvNode = beta - alpha > 1;
+        Zobrist::Key key = state_.getHash();
+        TableEntry entry;
+        bool found = table_ && table_->probe(key, entry);
+        if (found && !pvNode) {
+            int score = scoreFromTable(entry.score, ply);
+            if (entry.bound == Bound::EXACT || (entry.bound == Bound::LOWER && score >= beta) ||
+                (entry.bound == Bound::UPPER && score <= alpha)) {
+                return score;
+            }
+        }
+
+        MovePicker picker(state_, *history_, found ? entry.move : EngineMove::none());
+        int originalAlpha = alpha;
+        EngineMove bestMove = EngineMove::none();
+        int moveCount = 0;
+        UndoInfo undo;
+        EngineMove move;
+        while (!(move = picker.next()).isNone()) {
+            ++moveCount;
+            if (!inCheck && !move.isPromotion() &&
+                standPat + capturedValue(move) + DELTA_MARGIN <= alpha) {
+                continue;
+            }
+
+            movedPiece_[ply] = state_.pieceIndexAt(move.getFrom());
+            path_[ply] = move;
+            keys_.push_back(state_.getHash());
+            evaluator_->push(state_, move);
+            state_.makeMove(move, undo);
+            int score = -quiescence(-beta, -alpha, ply + 1);
+            state_.unmakeMove(move, undo);
+            evaluator_->pop();
+            keys_.pop_back();
+
+            if (aborted_) {
+                return 0;
+            }
+            if (score > alpha) {
+                alpha = score;
+                bestMove = move;
+                updatePv(ply, move);
+                if (alpha >= beta) {
+                    break;
+                }
+            }
+        }
+
+        if (inCheck && moveCount == 0) {
+            return -MATE_SCORE + ply;
+        }
+        // Une entrée de la recherche principale, plus profonde, est conservée
+        if (table_ && !(found && entry.depth > 0)) {
+            Bound bound = alpha >= beta ? Bound::LOWER : alpha > originalAlpha ? Bound::EXACT : Bound::UPPER;
+            table_->store(key, bestMove, scoreToTable(alpha, ply), 0, 0, bound);
+        }
+        return alpha;
+    }
+
+    int capturedValue(const EngineMove& move) const {
+        if (move.isEnPassant()) {
+            return StaticExchange::valueOf(PieceType::PAWN);
+        }
+        return state_.isEmpty(move.getTo()) ? 0 : StaticExchange::valueOf(state_.pieceAt(move.getTo()).getType());
+    }
+
+    /**
+     * Les scores de mat sont stockés relativement au nœud (distance depuis celui-ci),
+     * puisque la même position peut être atteinte à des profondeurs différentes
+     */
+    static int scoreToTable(int score, int ply) {
+        if (score >= MATE_BOUND) {
+            return score + ply;
+        }
+        return score <= -MATE_BOUND ? score - ply : score;
+    }
+
+    static int scoreFromTable(int score, int ply) {
+        if (score >= MATE_BOUND) {
+            return score - ply;
+        }
+        return score <= -MATE_BOUND ? score + ply : score;
+    }
+
+    /**
+     * Historique de continuation du coup joué à un demi-coup donné (nullptr hors de l'arbre)
+     */
+    const MoveHistory::PieceToHistory* continuationAt(int ply) const {
+        if (ply < 0 || movedPiece_[ply] == BoardState::NO_PIECE) {
+            return nullptr;
+        }
+        return &history_->continuation[movedPiece_[ply]][path_[ply].getTo()];
+    }
+
+    /**
+     * Récompense le coup calme qui a provoqué la coupure et pénalise ceux essayés avant lui ;
+     * il devient aussi coup tueur de ce demi-coup et contre-coup du coup précédent
+     */
+    void updateQuietHistory(int ply, int depth, const EngineMove& move, const EngineMove* quietsTried,
+                            int quietCount) {
+        int bonus = MoveHistory::bonus(depth);
+        int side = static_cast<int>(state_.getSideToMove());
+        updateQuietScore(ply, side, move, bonus);
+        for (int i = 0; i < quietCount; ++i) {
+            updateQuietScore(ply, side, quietsTried[i], -bonus);
+        }
+
+        if (!(killers_[ply][0] == move)) {
+            killers_[ply][1] = killers_[ply][0];
+            killers_[ply][0] = move;
+        }
+        if (ply > 0 && movedPiece_[ply - 1] != BoardState::NO_PIECE) {
+            history_->counterMoves[movedPiece_[ply - 1]][path_[ply - 1].getTo()] = move;
+        }
+    }
+
+    void updateQuietScore(int ply, int side, const EngineMove& move, int bonus) {
+        int piece = state_.pieceIndexAt(move.getFrom());
+        MoveHistory::update(history_->butterfly[side][move.getFrom()][move.getTo()], bonus);
+        for (int offset = 1; offset <= 2; ++offset) {
+            if (ply >= offset && movedPiece_[ply - offset] != BoardState::NO_PIECE) {
+                MoveHistory::PieceToHistory& continuation =
+                    history_->continuation[movedPiece_[ply - offset]][path_[ply - offset].getTo()];
+                MoveHistory::update(continuation[piece][move.getTo()], bonus);
+            }
+        }
+    }
+
+    /**
+     * Variation principale d'un nœud : son meilleur coup suivi de celle de l'enfant
+     */
+    void updatePv(int ply, const EngineMove& move) {
+        pv_[ply][0] = move;
+        int childLength = pvLength_[ply + 1];
+        std::copy(pv_[ply + 1], pv_[ply + 1] + childLength, pv_[ply] + 1);
+        pvLength_[ply] = childLength + 1;
+    }
+
+    bool isOnPreviousPv(int ply) const {
+        for (int i = 0; i < ply; ++i) {
+            if (!(path_[i] == previousPv_[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Nulle par la règle des 50 coups ou par répétition
+     * Une seule répétition suffit dans l'arbre : la rejouer ne peut rien apporter de plus.
+     */
+    bool isDraw() const {
+        int clock = state_.getHalfmoveClock();
+        if (clock >= 100) {
+            return true;
+        }
+        Zobrist::Key key = state_.getHash();
+        // Seules les positions au même trait depuis le dernier coup irréversible peuvent se répéter
+        int last = static_cast<int>(keys_.size()) - 1;
+        for (int i = last - 1; i >= 0 && i >= last - clock + 1; i -= 2) {
+            if (keys_[i] == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool shouldStop() {
+        if (stop_.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        std::uint64_t nodes = getNodes();
+        if (limits_.nodes > 0 && nodes >= limits_.nodes) {
+            return true;
+        }
+        return hardLimit_ > 0 && nodes % CLOCK_CHECK_INTERVAL == 0 && elapsedMilliseconds() >= hardLimit_;
+    }
+
+    std::int64_t elapsedMilliseconds() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+    double elapsedSeconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+};
+
+#endif // SEARCH_HPP
\ No newline at end of file
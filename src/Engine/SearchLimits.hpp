@@ -0,0 +1,49 @@
+#ifndef SEARCH_LIMITS_HPP
+#define SEARCH_LIMITS_HPP
+
+#include "../Enums/Color.hpp"
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * Bornes d'une recherche, telles que transmises par la commande UCI "go"
+ * Une valeur nulle signifie "pas de limite" pour le champ concerné.
+ */
+struct SearchLimits {
+    int depth = 0;
+    std::uint64_t nodes = 0;
+    std::int64_t moveTime = 0;            // Temps imposé pour le coup (ms)
+    std::int64_t time[2] = {0, 0};        // Pendule restante des blancs et des noirs (ms)
+    std::int64_t increment[2] = {0, 0};   // Incrément par coup (ms)
+    int movesToGo = 0;
+    bool infinite = false;                // Jusqu'à "stop", même une fois la profondeur maximale atteinte
+
+    bool hasClock(Color us) const {
+        return time[static_cast<int>(us)] > 0;
+    }
+
+    /**
+     * Temps alloué au coup (ms), 0 si la recherche n'est pas limitée dans le temps
+     * @param overhead Marge réservée à la communication avec l'interface
+     */
+    std::int64_t allocatedTime(Color us, std::int64_t overhead) const {
+        if (infinite) {
+            return 0;
+        }
+        if (moveTime > 0) {
+            return std::max<std::int64_t>(1, moveTime - overhead);
+        }
+        if (!hasClock(us)) {
+            return 0;
+        }
+
+        std::int64_t remaining = time[static_cast<int>(us)];
+        std::int64_t inc = increment[static_cast<int>(us)];
+        // Sans indication, on suppose une trentaine de coups à jouer
+        int moves = movesToGo > 0 ? movesToGo : 30;
+        std::int64_t budget = remaining / moves + inc * 3 / 4;
+        return std::max<std::int64_t>(1, std::min(budget, remaining - overhead));
+    }
+};
+
+#endif // SEARCH_LIMITS_HPP
\ No newline at end of file
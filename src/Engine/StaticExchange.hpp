@@ -0,0 +1,119 @@
+#ifndef STATIC_EXCHANGE_HPP
+#define STATIC_EXCHANGE_HPP
+
+#include "../Core/Attacks.hpp"
+#include "../Core/Bitboard.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/PieceCode.hpp"
+#include "../Enums/Color.hpp"
+#include "../Enums/PieceType.hpp"
+#include "../Utils/EngineMove.hpp"
+#include <algorithm>
+
+/**
+ * Évaluation statique des échanges (SEE)
+ *
+ * Bilan matériel, en centipions, de la suite de captures sur la case d'arrivée d'un coup :
+ * chaque camp reprend avec sa pièce la moins chère et peut s'arrêter dès que continuer
+ * lui coûterait. Les pièces qui attaquent à travers une autre (tour derrière une tour,
+ * fou ou dame derrière un pion...) entrent en jeu à mesure que la case se dégage.
+ * Les clouages ne sont pas pris en compte ; le roi ne reprend que sur une case non défendue.
+ */
+class StaticExchange {
+public:
+    /**
+     * Gain du camp au trait en jouant le coup puis en menant l'échange au mieux (0 pour un roque)
+     */
+    static int evaluate(const BoardState& state, const EngineMove& move) {
+        if (move.isCastling()) {
+            return 0;
+        }
+
+        int from = move.getFrom();
+        int to = move.getTo();
+        Bitboard occupied = state.getOccupancy() ^ Bitboards::squareBB(from);
+
+        int gain[MAX_EXCHANGES];
+        int depth = 0;
+        if (move.isEnPassant()) {
+            gain[0] = valueOf(PieceType::PAWN);
+            int captured = state.getSideToMove() == Color::WHITE ? to - 8 : to + 8;
+            occupied ^= Bitboards::squareBB(captured);
+        } else {
+            gain[0] = state.isEmpty(to) ? 0 : valueOf(state.pieceAt(to).getType());
+        }
+        // Valeur de la pièce qui se trouve désormais sur la case, exposée à la reprise
+        int onSquare = valueOf(state.pieceAt(from).getType());
+        if (move.isPromotion()) {
+            gain[0] += valueOf(move.getPromotion()) - valueOf(PieceType::PAWN);
+            onSquare = valueOf(move.getPromotion());
+        }
+
+        Bitboard diagonals = state.getPieces(PieceType::BISHOP) | state.getPieces(PieceType::QUEEN);
+        Bitboard lines = state.getPieces(PieceType::ROOK) | state.getPieces(PieceType::QUEEN);
+        Bitboard attackers = state.attackersTo(to, occupied) & occupied;
+        Color side = oppositeColor(state.getSideToMove());
+
+        while (depth + 1 < MAX_EXCHANGES) {
+            Bitboard ours = attackers & state.getOccupancy(side);
+            if (!ours) {
+                break;
+            }
+            PieceType type = leastValuable(state, side, ours);
+            // Le roi ne peut pas prendre une pièce encore défendue
+            if (type == PieceType::KING && (attackers & state.getOccupancy(oppositeColor(side)))) {
+                break;
+            }
+
+            ++depth;
+            gain[depth] = onSquare - gain[depth - 1];
+            // Reprendre ou non, ce camp reste perdant : le signe du résultat est acquis
+            if (std::max(-gain[depth - 1], gain[depth]) < 0) {
+                --depth;
+                break;
+            }
+
+            onSquare = valueOf(type);
+            occupied ^= Bitboards::squareBB(Bitboards::lsb(ours & state.getPieces(side, type)));
+            if (type == PieceType::PAWN || type == PieceType::BISHOP || type == PieceType::QUEEN) {
+                attackers |= Attacks::bishopAttacks(to, occupied) & diagonals;
+            }
+            if (type == PieceType::ROOK || type == PieceType::QUEEN) {
+                attackers |= Attacks::rookAttacks(to, occupied) & lines;
+            }
+            attackers &= occupied;
+            side = oppositeColor(side);
+        }
+
+        // Chaque camp choisit entre reprendre et s'arrêter, du dernier échange au premier
+        while (depth > 0) {
+            gain[depth - 1] = -std::max(-gain[depth - 1], gain[depth]);
+            --depth;
+        }
+        return gain[0];
+    }
+
+    /**
+     * Valeur d'une pièce pour les échanges (en centipions ; le roi vaut plus que tout le reste)
+     */
+    static int valueOf(PieceType type) {
+        return type == PieceType::KING ? KING_VALUE : 100 * PieceRules::value(type);
+    }
+
+private:
+    static constexpr int MAX_EXCHANGES = 32;
+    static constexpr int KING_VALUE = 20000;
+
+    static PieceType leastValuable(const BoardState& state, Color side, Bitboard attackers) {
+        static constexpr PieceType ORDER[] = {PieceType::PAWN, PieceType::KNIGHT, PieceType::BISHOP,
+                                              PieceType::ROOK, PieceType::QUEEN, PieceType::KING};
+        for (PieceType type : ORDER) {
+            if (attackers & state.getPieces(side, type)) {
+                return type;
+            }
+        }
+        return PieceType::KING;
+    }
+};
+
+#endif // STATIC_EXCHANGE_HPP
\ No newline at end of file
@@ -0,0 +1,235 @@
+#ifndef TRANSPOSITION_TABLE_HPP
+#define TRANSPOSITION_TABLE_HPP
+
+#include "../Core/Zobrist.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * Nature du score enregistré : exact, borne inférieure (coupure bêta) ou supérieure (aucun coup n'a dépassé alpha)
+ */
+enum class Bound : std::uint8_t {
+    NONE,
+    UPPER,
+    LOWER,
+    EXACT
+};
+
+/**
+ * Contenu d'une entrée, une fois la clé vérifiée
+ */
+struct TableEntry {
+    EngineMove move;
+    int score;
+    int eval;
+    int depth;
+    Bound bound;
+};
+
+/**
+ * Table de transposition partagée par tous les threads de recherche
+ *
+ * Comme PerftCache, chaque entrée stocke sa donnée sur 64 bits et (clé XOR donnée) :
+ * une lecture déchirée par une écriture concurrente ne vérifie plus la clé et
+ * compte comme un échec de sondage, sans verrou ni corruption possible.
+ *
+ * Donnée : coup (16 bits) | score (16) | évaluation statique (16) | profondeur (8) | âge (6) | borne (2).
+ * Les seaux de quatre entrées occupent exactement une ligne de cache.
+ * En cas de collision, l'entrée remplacée est la moins profonde, les entrées
+ * des recherches précédentes (âge différent) étant sacrifiées en priorité.
+ */
+class TranspositionTable {
+private:
+    struct Entry {
+        std::atomic<std::uint64_t> check;   // clé XOR donnée
+        std::atomic<std::uint64_t> data;
+    };
+
+    static constexpr size_t BUCKET_SIZE = 4;
+
+    struct alignas(64) Bucket {
+        Entry entries[BUCKET_SIZE];
+    };
+
+    static constexpr int AGE_BITS = 6;
+    static constexpr int AGE_CYCLE = 1 << AGE_BITS;
+    // Un âge d'écart coûte autant que AGE_PENALTY demi-coups de profondeur au remplacement
+    static constexpr int AGE_PENALTY = 8;
+    static constexpr size_t HASHFULL_SAMPLE = 1000 / BUCKET_SIZE;
+
+    std::unique_ptr<Bucket[]> buckets_;
+    size_t bucketMask_;
+    std::uint8_t age_;
+
+public:
+    /**
+     * Constructeur
+     * @param megabytes Taille de la table en Mo (arrondie à la puissance de deux inférieure)
+     */
+    explicit TranspositionTable(size_t megabytes = 16) : bucketMask_(0), age_(0) {
+        resize(megabytes);
+    }
+
+    /**
+     * Réalloue la table (son contenu est perdu)
+     */
+    void resize(size_t megabytes) {
+        size_t bytes = std::max<size_t>(megabytes, 1) * 1024 * 1024;
+        size_t buckets = 1;
+        while (buckets * 2 * sizeof(Bucket) <= bytes) {
+            buckets *= 2;
+        }
+        buckets_.reset();
+        buckets_.reset(new Bucket[buckets]);
+        bucketMask_ = buckets - 1;
+        clear();
+    }
+
+    /**
+     * Vide la table
+     * @param threads Threads qui se partagent l'effacement (les grandes tables se chiffrent en Go)
+     */
+    void clear(size_t threads = 1) {
+        size_t count = bucketMask_ + 1;
+        threads = std::max<size_t>(1, std::min(threads, count));
+        auto clearRange = [this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                for (Entry& entry : buckets_[i].entries) {
+                    entry.check.store(0, std::memory_order_relaxed);
+                    entry.data.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        if (threads == 1) {
+            clearRange(0, count);
+        } else {
+            ThreadPool pool(threads);
+            for (size_t t = 0; t < threads; ++t) {
+                pool.submit([&clearRange, count, threads, t] {
+                    clearRange(count * t / threads, count * (t + 1) / threads);
+                });
+            }
+            pool.wait();
+        }
+        age_ = 0;
+    }
+
+    /**
+     * Change d'âge au début de chaque recherche : les entrées anciennes deviennent remplaçables
+     */
+    void newSearch() {
+        age_ = static_cast<std::uint8_t>((age_ + 1) % AGE_CYCLE);
+    }
+
+    size_t sizeInBytes() const {
+        return (bucketMask_ + 1) * sizeof(Bucket);
+    }
+
+    /**
+     * Précharge le seau d'une position dans le cache du processeur
+     */
+    void prefetch(Zobrist::Key key) const {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(&buckets_[key & bucketMask_]);
+#else
+        (void)key;
+#endif
+    }
+
+    /**
+     * Cherche une position
+     * @return true si elle est trouvée (entry est alors rempli)
+     */
+    bool probe(Zobrist::Key key, TableEntry& entry) const {
+        const Bucket& bucket = buckets_[key & bucketMask_];
+        for (const Entry& slot : bucket.entries) {
+            std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+            std::uint64_t check = slot.check.load(std::memory_order_relaxed);
+            if ((check ^ data) == key && data != 0) {
+                entry.move = EngineMove::fromRaw(static_cast<std::uint16_t>(data));
+                entry.score = static_cast<std::int16_t>(data >> 16);
+                entry.eval = static_cast<std::int16_t>(data >> 32);
+                entry.depth = static_cast<int>((data >> 48) & 0xFF);
+                entry.bound = static_cast<Bound>((data >> 56) & 0x3);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Enregistre le résultat d'une recherche
+     * Une entrée de la même position garde son coup si le nouveau résultat n'en a pas.
+     */
+    void store(Zobrist::Key key, const EngineMove& move, int score, int eval, int depth, Bound bound) {
+        Bucket& bucket = buckets_[key & bucketMask_];
+        Entry* target = nullptr;
+        int worstValue = 0;
+        std::uint64_t previous = 0;
+
+        for (Entry& slot : bucket.entries) {
+            std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+            std::uint64_t check = slot.check.load(std::memory_order_relaxed);
+            if (data == 0 || (check ^ data) == key) {
+                target = &slot;
+                previous = (check ^ data) == key ? data : 0;
+                break;
+            }
+            int value = replacementValue(data);
+            if (!target || value < worstValue) {
+                target = &slot;
+                worstValue = value;
+            }
+        }
+
+        std::uint16_t rawMove = move.getRaw();
+        if (move.isNone() && previous != 0) {
+            rawMove = static_cast<std::uint16_t>(previous);
+        }
+        std::uint64_t data = static_cast<std::uint64_t>(rawMove) |
+                             static_cast<std::uint64_t>(static_cast<std::uint16_t>(score)) << 16 |
+                             static_cast<std::uint64_t>(static_cast<std::uint16_t>(eval)) << 32 |
+                             static_cast<std::uint64_t>(std::clamp(depth, 0, 255)) << 48 |
+                             static_cast<std::uint64_t>(age_ << 2 | static_cast<std::uint8_t>(bound)) << 56;
+        target->data.store(data, std::memory_order_relaxed);
+        target->check.store(key ^ data, std::memory_order_relaxed);
+    }
+
+    /**
+     * Remplissage en pour mille (statistique UCI "hashfull")
+     * Estimé sur les premiers seaux : seules les entrées de la recherche en cours comptent.
+     */
+    int hashfull() const {
+        size_t sample = std::min(HASHFULL_SAMPLE, bucketMask_ + 1);
+        int used = 0;
+        for (size_t i = 0; i < sample; ++i) {
+            for (const Entry& slot : buckets_[i].entries) {
+                std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+                used += data != 0 && ageOf(data) == age_;
+            }
+        }
+        return static_cast<int>(used * 1000 / (sample * BUCKET_SIZE));
+    }
+
+private:
+    static int ageOf(std::uint64_t data) {
+        return static_cast<int>(data >> 58);
+    }
+
+    /**
+     * Intérêt de garder une entrée : sa profondeur, moins une pénalité par recherche écoulée
+     */
+    int replacementValue(std::uint64_t data) const {
+        int depth = static_cast<int>((data >> 48) & 0xFF);
+        int elapsed = (AGE_CYCLE + age_ - ageOf(data)) % AGE_CYCLE;
+        return depth - AGE_PENALTY * elapsed;
+    }
+};
+
+#endif // TRANSPOSITION_TABLE_HPP
\ No newline at end of file
@@ -6,4 +6,11 @@ enum class Color {
     BLACK,
 };
 
+/**
+ * Retourne la couleur adverse
+ */
+constexpr Color oppositeColor(Color color) {
+    return color == Color::WHITE ? Color::BLACK : Color::WHITE;
+}
+
 #endif // COLOR_HPP
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef GENERATION_TYPE_HPP
+#define GENERATION_TYPE_HPP
+
+/**
+ * Sous-ensemble de coups à produire par le générateur
+ * CAPTURES inclut toutes les promotions, QUIETS tout le reste (roque compris)
+ */
+enum class GenerationType {
+    ALL,
+    CAPTURES,
+    QUIETS
+};
+
+#endif // GENERATION_TYPE_HPP
\ No newline at end of file
@@ -0,0 +1,195 @@
+#ifndef FEN_LOADER_HPP
+#define FEN_LOADER_HPP
+
+#include "MappedFile.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/Fen.hpp"
+#include "../Core/PackedPosition.hpp"
+#include "../Utils/ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Ligne rejetée par le chargeur
+ */
+struct FenError {
+    size_t line;          // Numéro de ligne (à partir de 1)
+    std::string message;
+};
+
+/**
+ * Résultat d'un chargement : positions dans l'ordre du fichier, erreurs et débit
+ */
+struct FenLoadResult {
+    std::vector<PackedPosition> positions;
+    std::vector<FenError> errors;
+    size_t lines = 0;
+    double seconds = 0.0;
+
+    double positionsPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(positions.size()) / seconds : 0.0;
+    }
+};
+
+/**
+ * Chargement en masse de fichiers FEN/EPD (une position par ligne)
+ *
+ * Le fichier est projeté en mémoire et découpé en blocs alignés sur les fins
+ * de ligne. Une première passe compte les lignes de chaque bloc pour fixer la
+ * place de chaque position dans le tableau final ; la seconde analyse les blocs
+ * en parallèle directement dans ce tableau, sans copier les lignes.
+ * Les lignes vides et celles qui commencent par '#' sont ignorées.
+ */
+class FenLoader {
+private:
+    // Taille minimale d'un bloc : en dessous, le découpage coûte plus qu'il ne rapporte
+    static constexpr size_t MIN_CHUNK_BYTES = 1 << 16;
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    struct Chunk {
+        std::string_view text;
+        size_t firstLine = 0;
+        size_t lineCount = 0;
+        std::vector<FenError> errors;
+    };
+
+public:
+    /**
+     * Charge un fichier
+     * @param threads Nombre de threads (0 = tous les cœurs)
+     * @throws std::runtime_error si le fichier ne peut pas être lu
+     */
+    static FenLoadResult load(const std::string& path, size_t threads = 0) {
+        MappedFile file(path);
+        return parse(file.view(), threads);
+    }
+
+    /**
+     * Analyse un texte déjà en mémoire (même format que le fichier)
+     */
+    static FenLoadResult parse(std::string_view text, size_t threads = 0) {
+        auto start = std::chrono::steady_clock::now();
+        FenLoadResult result;
+
+        if (threads == 0) {
+            threads = ThreadPool::defaultThreadCount();
+        }
+        std::vector<Chunk> chunks = split(text, threads * CHUNKS_PER_THREAD);
+        std::vector<std::uint8_t> valid;
+
+        {
+            ThreadPool pool(threads);
+
+            // Passe 1 : nombre de lignes par bloc
+            for (Chunk& chunk : chunks) {
+                pool.submit([&chunk] { chunk.lineCount = countLines(chunk.text); });
+            }
+            pool.wait();
+
+            for (Chunk& chunk : chunks) {
+                chunk.firstLine = result.lines;
+                result.lines += chunk.lineCount;
+            }
+            result.positions.resize(result.lines);
+            valid.assign(result.lines, 0);
+
+            // Passe 2 : chaque bloc remplit sa propre tranche du tableau
+            for (Chunk& chunk : chunks) {
+                pool.submit([&chunk, &result, &valid] {
+                    parseChunk(chunk, result.positions.data() + chunk.firstLine, valid.data() + chunk.firstLine);
+                });
+            }
+            pool.wait();
+        }
+
+        // Retire les lignes ignorées ou rejetées en gardant l'ordre du fichier
+        size_t kept = 0;
+        for (size_t i = 0; i < result.lines; ++i) {
+            if (valid[i]) {
+                if (kept != i) {
+                    result.positions[kept] = result.positions[i];
+                }
+                ++kept;
+            }
+        }
+        result.positions.resize(kept);
+
+        for (Chunk& chunk : chunks) {
+            for (FenError& error : chunk.errors) {
+                result.errors.push_back(std::move(error));
+            }
+        }
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+private:
+    /**
+     * Découpe le texte en blocs qui commencent toujours en début de ligne
+     */
+    static std::vector<Chunk> split(std::string_view text, size_t wanted) {
+        size_t count = std::max<size_t>(1, std::min(wanted, text.size() / MIN_CHUNK_BYTES));
+        std::vector<Chunk> chunks;
+        chunks.reserve(count);
+
+        size_t begin = 0;
+        for (size_t i = 1; i <= count && begin < text.size(); ++i) {
+            size_t end = i == count ? text.size() : std::max(begin, text.size() * i / count);
+            if (end < text.size()) {
+                size_t newline = text.find('\n', end);
+                end = newline == std::string_view::npos ? text.size() : newline + 1;
+            }
+            Chunk chunk;
+            chunk.text = text.substr(begin, end - begin);
+            chunks.push_back(std::move(chunk));
+            begin = end;
+        }
+        return chunks;
+    }
+
+    static size_t countLines(std::string_view text) {
+        size_t lines = static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+        if (!text.empty() && text.back() != '\n') {
+            ++lines; // Dernière ligne sans fin de ligne
+        }
+        return lines;
+    }
+
+    static void parseChunk(Chunk& chunk, PackedPosition* positions, std::uint8_t* valid) {
+        std::string_view text = chunk.text;
+        BoardState state;
+        size_t begin = 0;
+        for (size_t line = 0; line < chunk.lineCount; ++line) {
+            size_t end = text.find('\n', begin);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            std::string_view fen = text.substr(begin, end - begin);
+            begin = end + 1;
+
+            if (!fen.empty() && fen.back() == '\r') {
+                fen.remove_suffix(1);
+            }
+            if (fen.empty() || fen[0] == '#') {
+                continue;
+            }
+
+            const char* error = Fen::read(fen, state);
+            if (!error && !PackedPosition::pack(state, positions[line])) {
+                error = "plus de 32 pièces";
+            }
+            if (error) {
+                chunk.errors.push_back(FenError{chunk.firstLine + line + 1, error});
+            } else {
+                valid[line] = 1;
+            }
+        }
+    }
+};
+
+#endif // FEN_LOADER_HPP
\ No newline at end of file
@@ -0,0 +1,127 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Fichier projeté en mémoire, en lecture seule
+ * Le contenu est exposé tel quel sous forme de string_view : aucune copie,
+ * les vues restent valides tant que l'objet existe.
+ */
+class MappedFile {
+private:
+    const char* data_;
+    size_t size_;
+#if defined(_WIN32)
+    HANDLE file_;
+    HANDLE mapping_;
+#else
+    int fd_;
+#endif
+
+public:
+    /**
+     * Ouvre et projette un fichier
+     * @throws std::runtime_error si le fichier ne peut pas être ouvert ou projeté
+     */
+    explicit MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+#if defined(_WIN32)
+        mapping_ = nullptr;
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Impossible d'ouvrir " + path);
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(file_, &size);
+        size_ = static_cast<size_t>(size.QuadPart);
+        if (size_ > 0) {
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            data_ = mapping_ ? static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+            if (!data_) {
+                close();
+                throw std::runtime_error("Impossible de projeter " + path);
+            }
+        }
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            throw std::runtime_error("Impossible d'ouvrir " + path);
+        }
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) {
+            close();
+            throw std::runtime_error("Impossible de lire la taille de " + path);
+        }
+        size_ = static_cast<size_t>(info.st_size);
+        if (size_ > 0) {
+            void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (address == MAP_FAILED) {
+                close();
+                throw std::runtime_error("Impossible de projeter " + path);
+            }
+            data_ = static_cast<const char*>(address);
+            // Lecture séquentielle : le noyau peut lire en avance
+            ::madvise(address, size_, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view view() const {
+        return std::string_view(data_, size_);
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+private:
+    void close() {
+#if defined(_WIN32)
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        fd_ = -1;
+#endif
+        data_ = nullptr;
+    }
+};
+
+#endif // MAPPED_FILE_HPP
\ No newline at end of file
@@ -0,0 +1,285 @@
+#ifndef PGN_READER_HPP
+#define PGN_READER_HPP
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * Éléments lexicaux d'une partie PGN
+ */
+enum class PgnTokenType {
+    TAG,              // [Nom "Valeur"] : text = nom, value = valeur (échappements non traités)
+    MOVE_NUMBER,      // "12." ou "12..."
+    MOVE,             // Coup SAN, annotations !? comprises
+    COMMENT,          // {...} ou ; jusqu'à la fin de la ligne (text = contenu)
+    NAG,              // $12
+    VARIATION_START,  // (
+    VARIATION_END,    // )
+    RESULT,           // 1-0, 0-1, 1/2-1/2 ou *
+    END
+};
+
+/**
+ * Élément lexical : vues sur le texte source, aucune copie
+ */
+struct PgnToken {
+    PgnTokenType type;
+    std::string_view text;
+    std::string_view value;
+    size_t line;            // Ligne dans le texte analysé (à partir de 0)
+};
+
+/**
+ * Découpe le texte d'une partie en éléments PGN, sans allocation
+ */
+class PgnTokenizer {
+private:
+    std::string_view text_;
+    size_t pos_;
+    size_t line_;
+
+public:
+    explicit PgnTokenizer(std::string_view text) : text_(text), pos_(0), line_(0) {}
+
+    /**
+     * Lit l'élément suivant
+     * @return false à la fin du texte (token.type vaut alors END)
+     */
+    bool next(PgnToken& token) {
+        skipWhitespace();
+        token.value = std::string_view();
+        token.line = line_;
+        if (pos_ >= text_.size()) {
+            token.type = PgnTokenType::END;
+            token.text = std::string_view();
+            return false;
+        }
+
+        char c = text_[pos_];
+        switch (c) {
+            case '[':
+                readTag(token);
+                return true;
+            case '{': {
+                size_t close = text_.find('}', pos_ + 1);
+                size_t end = close == std::string_view::npos ? text_.size() : close;
+                token.type = PgnTokenType::COMMENT;
+                token.text = text_.substr(pos_ + 1, end - pos_ - 1);
+                countLines(pos_, end);
+                pos_ = end == text_.size() ? end : end + 1;
+                return true;
+            }
+            case ';': {
+                size_t end = lineEnd(pos_);
+                token.type = PgnTokenType::COMMENT;
+                token.text = text_.substr(pos_ + 1, end - pos_ - 1);
+                pos_ = end;
+                return true;
+            }
+            case '(':
+                token.type = PgnTokenType::VARIATION_START;
+                token.text = text_.substr(pos_++, 1);
+                return true;
+            case ')':
+                token.type = PgnTokenType::VARIATION_END;
+                token.text = text_.substr(pos_++, 1);
+                return true;
+            default:
+                break;
+        }
+
+        // Symbole : suite de caractères jusqu'à un espace ou un délimiteur
+        size_t start = pos_;
+        while (pos_ < text_.size() && !isDelimiter(text_[pos_])) {
+            ++pos_;
+        }
+        // Numéro de coup collé au coup ("1.e4") : les points terminent le numéro
+        std::string_view symbol = text_.substr(start, pos_ - start);
+        size_t digits = 0;
+        while (digits < symbol.size() && symbol[digits] >= '0' && symbol[digits] <= '9') {
+            ++digits;
+        }
+        if (digits > 0 && digits < symbol.size() && symbol[digits] == '.') {
+            size_t dots = digits;
+            while (dots < symbol.size() && symbol[dots] == '.') {
+                ++dots;
+            }
+            pos_ = start + dots;
+            token.type = PgnTokenType::MOVE_NUMBER;
+            token.text = symbol.substr(0, dots);
+            return true;
+        }
+
+        token.text = symbol;
+        if (symbol == "1-0" || symbol == "0-1" || symbol == "1/2-1/2" || symbol == "*") {
+            token.type = PgnTokenType::RESULT;
+        } else if (symbol[0] == '$') {
+            token.type = PgnTokenType::NAG;
+        } else if (digits == symbol.size()) {
+            token.type = PgnTokenType::MOVE_NUMBER; // Numéro isolé sans point
+        } else {
+            token.type = PgnTokenType::MOVE;
+        }
+        return true;
+    }
+
+private:
+    static bool isDelimiter(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '{' || c == '}' ||
+               c == '(' || c == ')' || c == '[' || c == ']' || c == ';';
+    }
+
+    size_t lineEnd(size_t from) const {
+        size_t end = text_.find('\n', from);
+        return end == std::string_view::npos ? text_.size() : end;
+    }
+
+    void countLines(size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            line_ += text_[i] == '\n';
+        }
+    }
+
+    /**
+     * Saute les blancs, les lignes d'échappement '%' et les caractères isolés invalides
+     */
+    void skipWhitespace() {
+        while (pos_ < text_.size()) {
+            char c = text_[pos_];
+            if (c == '\n') {
+                ++line_;
+                ++pos_;
+                if (pos_ < text_.size() && text_[pos_] == '%') {
+                    pos_ = lineEnd(pos_);
+                }
+            } else if (c == ' ' || c == '\t' || c == '\r' || c == ']' || c == '}') {
+                ++pos_;
+            } else if (c == '%' && pos_ == 0) {
+                pos_ = lineEnd(pos_);
+            } else {
+                return;
+            }
+        }
+    }
+
+    void readTag(PgnToken& token) {
+        token.type = PgnTokenType::TAG;
+        size_t end = lineEnd(pos_);
+        size_t close = text_.rfind(']', end);
+        if (close == std::string_view::npos || close < pos_) {
+            close = end;
+        }
+
+        std::string_view tag = text_.substr(pos_ + 1, close - pos_ - 1);
+        size_t nameEnd = tag.find_first_of(" \t\"");
+        token.text = tag.substr(0, nameEnd);
+
+        size_t open = tag.find('"');
+        size_t quote = tag.rfind('"');
+        if (open != std::string_view::npos && quote > open) {
+            token.value = tag.substr(open + 1, quote - open - 1);
+        }
+        pos_ = close < end ? close + 1 : end;
+    }
+};
+
+/**
+ * Partie brute : vue sur son texte (balises et coups) dans le fichier
+ */
+struct PgnGame {
+    std::string_view text;
+    size_t number;      // Numéro de la partie dans le fichier (à partir de 1)
+    size_t firstLine;   // Ligne de début dans le fichier (à partir de 1)
+};
+
+/**
+ * Découpe un texte PGN en parties, au fil de la lecture
+ * Une partie se termine quand une ligne de balise '[' suit des coups
+ * (les accolades des commentaires sont prises en compte).
+ */
+class PgnReader {
+private:
+    std::string_view text_;
+    size_t pos_;
+    size_t line_;
+    size_t games_;
+
+public:
+    explicit PgnReader(std::string_view text) : text_(text), pos_(0), line_(1), games_(0) {
+        // Marque d'ordre des octets UTF-8
+        if (text_.size() >= 3 && text_.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+            pos_ = 3;
+        }
+    }
+
+    /**
+     * Lit la partie suivante
+     * @return false quand le texte est épuisé
+     */
+    bool next(PgnGame& game) {
+        // Lignes vides avant la partie
+        while (pos_ < text_.size()) {
+            size_t end = lineEnd(pos_);
+            if (!isBlank(text_.substr(pos_, end - pos_))) {
+                break;
+            }
+            pos_ = end < text_.size() ? end + 1 : end;
+            ++line_;
+        }
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+
+        size_t start = pos_;
+        game.firstLine = line_;
+        bool inMovetext = false;
+        int braceDepth = 0;
+
+        while (pos_ < text_.size()) {
+            size_t end = lineEnd(pos_);
+            std::string_view line = text_.substr(pos_, end - pos_);
+
+            if (braceDepth == 0 && !line.empty() && line[0] == '[') {
+                if (inMovetext) {
+                    break; // Début de la partie suivante
+                }
+            } else if (braceDepth > 0 || !isBlank(line)) {
+                inMovetext = true;
+            }
+
+            for (char c : line) {
+                if (c == '{') {
+                    ++braceDepth;
+                } else if (c == '}' && braceDepth > 0) {
+                    --braceDepth;
+                } else if (c == ';' && braceDepth == 0) {
+                    break; // Commentaire jusqu'à la fin de la ligne
+                }
+            }
+
+            pos_ = end < text_.size() ? end + 1 : end;
+            ++line_;
+        }
+
+        game.text = text_.substr(start, pos_ - start);
+        game.number = ++games_;
+        return true;
+    }
+
+private:
+    size_t lineEnd(size_t from) const {
+        size_t end = text_.find('\n', from);
+        return end == std::string_view::npos ? text_.size() : end;
+    }
+
+    static bool isBlank(std::string_view line) {
+        for (char c : line) {
+            if (c != ' ' && c != '\t' && c != '\r') {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+#endif // PGN_READER_HPP
\ No newline at end of file
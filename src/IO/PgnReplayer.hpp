@@ -0,0 +1,194 @@
+#ifndef PGN_REPLAYER_HPP
+#define PGN_REPLAYER_HPP
+
+#include "MappedFile.hpp"
+#include "PgnReader.hpp"
+#include "../Core/BoardState.hpp"
+#include "../Core/Fen.hpp"
+#include "../Core/Notation.hpp"
+#include "../Utils/EngineMove.hpp"
+#include "../Utils/ThreadPool.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Partie interrompue par un coup illégal ou une position de départ invalide
+ */
+struct PgnError {
+    size_t game;          // Numéro de la partie (à partir de 1)
+    size_t line;          // Ligne du coup fautif dans le fichier
+    int ply;              // Demi-coup fautif (à partir de 1), 0 pour une erreur de balise
+    std::string move;     // Coup tel qu'écrit dans le fichier
+    std::string message;
+};
+
+/**
+ * Bilan d'un rejeu : volumes, erreurs et débit
+ */
+struct PgnReplayResult {
+    size_t games = 0;
+    std::uint64_t plies = 0;
+    std::vector<PgnError> errors;
+    double seconds = 0.0;
+
+    double gamesPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(games) / seconds : 0.0;
+    }
+
+    double pliesPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(plies) / seconds : 0.0;
+    }
+};
+
+/**
+ * Rejoue des parties PGN avec les règles du moteur
+ *
+ * Le fichier est projeté en mémoire et découpé en parties par le thread appelant ;
+ * les parties sont rejouées par lots sur un ThreadPool pendant que le découpage avance.
+ * Chaque coup doit figurer parmi les coups légaux, comme pour Game::makeMove.
+ * Les variantes et commentaires sont lus mais pas rejoués.
+ * Une partie s'arrête à son premier coup illégal.
+ */
+class PgnReplayer {
+private:
+    static constexpr size_t GAMES_PER_BATCH = 256;
+    // Lots en vol par thread : borne la mémoire sur les très gros fichiers
+    static constexpr size_t BATCHES_PER_THREAD = 8;
+
+    struct Batch {
+        std::vector<PgnGame> games;
+        std::uint64_t plies = 0;
+        std::vector<PgnError> errors;
+    };
+
+public:
+    /**
+     * Rejoue toutes les parties d'un fichier
+     * @param threads Nombre de threads (0 = tous les cœurs)
+     * @throws std::runtime_error si le fichier ne peut pas être lu
+     */
+    static PgnReplayResult replayFile(const std::string& path, size_t threads = 0) {
+        MappedFile file(path);
+        return replay(file.view(), threads);
+    }
+
+    /**
+     * Rejoue toutes les parties d'un texte PGN en mémoire
+     */
+    static PgnReplayResult replay(std::string_view text, size_t threads = 0) {
+        auto start = std::chrono::steady_clock::now();
+        PgnReplayResult result;
+
+        if (threads == 0) {
+            threads = ThreadPool::defaultThreadCount();
+        }
+        ThreadPool pool(threads);
+        PgnReader reader(text);
+        std::vector<Batch> wave(threads * BATCHES_PER_THREAD);
+        bool more = true;
+
+        while (more) {
+            // Chaque lot part dès qu'il est plein : le découpage continue pendant le rejeu
+            size_t used = 0;
+            PgnGame game;
+            while (used < wave.size() && more) {
+                Batch& batch = wave[used];
+                batch.games.clear();
+                batch.plies = 0;
+                batch.errors.clear();
+                while (batch.games.size() < GAMES_PER_BATCH && (more = reader.next(game))) {
+                    batch.games.push_back(game);
+                }
+                if (batch.games.empty()) {
+                    break;
+                }
+                pool.submit([&batch] {
+                    for (const PgnGame& entry : batch.games) {
+                        batch.plies += replayGame(entry, batch.errors);
+                    }
+                });
+                ++used;
+            }
+            pool.wait();
+
+            for (size_t i = 0; i < used; ++i) {
+                result.games += wave[i].games.size();
+                result.plies += wave[i].plies;
+                for (PgnError& error : wave[i].errors) {
+                    result.errors.push_back(std::move(error));
+                }
+            }
+        }
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    /**
+     * Rejoue une partie
+     * @param errors Reçoit l'erreur éventuelle
+     * @return Nombre de demi-coups joués
+     */
+    static int replayGame(const PgnGame& game, std::vector<PgnError>& errors) {
+        BoardState state = BoardState::startingPosition();
+        PgnTokenizer tokenizer(game.text);
+        PgnToken token;
+        int plies = 0;
+        int variationDepth = 0;
+        bool started = false;
+
+        while (tokenizer.next(token)) {
+            switch (token.type) {
+                case PgnTokenType::TAG:
+                    // Position de départ personnalisée (balise FEN, avec ou sans SetUp)
+                    if (!started && token.text == "FEN") {
+                        const char* error = Fen::read(token.value, state);
+                        if (error) {
+                            errors.push_back(PgnError{game.number, game.firstLine + token.line, 0,
+                                                      std::string(token.value), error});
+                            return plies;
+                        }
+                    }
+                    break;
+                case PgnTokenType::VARIATION_START:
+                    ++variationDepth;
+                    break;
+                case PgnTokenType::VARIATION_END:
+                    if (variationDepth > 0) {
+                        --variationDepth;
+                    }
+                    break;
+                case PgnTokenType::MOVE: {
+                    if (variationDepth > 0) {
+                        break;
+                    }
+                    started = true;
+                    EngineMove move;
+                    const char* error = Notation::readSan(state, token.text, move);
+                    if (error) {
+                        errors.push_back(PgnError{game.number, game.firstLine + token.line, plies + 1,
+                                                  std::string(token.text), error});
+                        return plies;
+                    }
+                    UndoInfo undo;
+                    state.makeMove(move, undo);
+                    ++plies;
+                    break;
+                }
+                case PgnTokenType::RESULT:
+                    if (variationDepth == 0) {
+                        return plies;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        return plies;
+    }
+};
+
+#endif // PGN_REPLAYER_HPP
\ No newline at end of file
@@ -2,48 +2,17 @@
 #define BISHOP_HPP
 
 #include "Piece.hpp"
-#include "DiagonalMovement.hpp"
 #include "../Utils/Constants.hpp"
 #include <memory>
 
 
-class Bishop : public Piece, public DiagonalMovement {
+class Bishop : public Piece {
 public:
 
     Bishop(const Position& position, Color color) 
         : Piece(position, color, PieceType::BISHOP) {}
     
 
-    /**
-     * @brief Determines if the bishop can move to the specified target position.
-     * 
-     * A bishop can only move diagonally on the chess board. This method checks
-     * if the target position is reachable by moving diagonally from the current
-     * position.
-     * 
-     * @param target The position to check if the bishop can move to
-     * @return true if the bishop can move to the target position, false otherwise
-     */
-    bool canMoveTo(const Position& target) const override {
-        return canMoveDiagonally(position_, target);
-    }
-    
-
-    /**
-     * @brief Gets the point value of the bishop piece.
-     * 
-     * Returns the standard chess point value for a bishop piece as defined
-     * in the ChessConstants. This value is typically used for position
-     * evaluation and material counting in chess engines.
-     * 
-     * @return The integer point value of the bishop piece
-     * @override Overrides the base Piece class getValue method
-     */
-    int getValue() const override {
-        return ChessConstants::PieceValues::BISHOP;
-    }
-    
-
     /**
      * @brief Creates a deep copy of the Bishop piece.
      * 
@@ -14,64 +14,6 @@ class Pawn : public Piece {
         : Piece(position, color, PieceType::PAWN) {}
     
 
-    /**
-     * @brief Determines if the pawn can move to the specified target position.
-     * 
-     * This method validates pawn movement according to chess rules:
-     * - Forward movement: one square forward, or two squares on first move
-     * - Diagonal capture: one square diagonally forward (assumed valid if target occupied)
-     * - Direction depends on piece color (white moves up, black moves down)
-     * 
-     * @param target The target position to move to
-     * @return true if the move is valid according to pawn movement rules, false otherwise
-     * 
-     * @note This method only validates movement patterns, not board state (obstacles, captures)
-     * @note White pawns move in positive Y direction, black pawns in negative Y direction
-     */
-    bool canMoveTo(const Position& target) const override {
-        if (position_ == target) {
-            return false;
-        }
-        
-        int deltaX = target.getX() - position_.getX();
-        int deltaY = target.getY() - position_.getY();
-        
-        int direction = (color_ == Color::WHITE) ? 1 : -1;
-        
-        
-        if (abs(deltaX) == 1 && deltaY == direction) {
-            return true;
-        }
-        
-        if (deltaX == 0) {
-            if (deltaY == direction) {
-                return true;
-            }
-            
-            if (!hasMoved_ && deltaY == 2 * direction) {
-                int initialRow = (color_ == Color::WHITE) ? 1 : 6;
-                return position_.getY() == initialRow;
-            }
-        }
-        
-        return false;
-    }
-    
-
-    /**
-     * @brief Gets the point value of the pawn piece.
-     * 
-     * Returns the standard chess piece value for a pawn as defined in the
-     * ChessConstants::PieceValues enumeration. This value is typically used
-     * for chess engine evaluation and scoring purposes.
-     * 
-     * @return The integer point value of a pawn piece
-     * @override This method overrides the base class getValue() method
-     */
-    int getValue() const override {
-        return ChessConstants::PieceValues::PAWN;
-    }
-    
     /**
      * @brief Creates a deep copy of the Pawn object.
      * 
@@ -97,11 +39,8 @@ class Pawn : public Piece {
      * @return true if the pawn can capture at the target position, false otherwise
      */
     bool canCapture(const Position& target) const {
-        int deltaX = abs(target.getX() - position_.getX());
-        int deltaY = target.getY() - position_.getY();
-        int direction = (color_ == Color::WHITE) ? 1 : -1;
-        
-        return deltaX == 1 && deltaY == direction;
+        return PieceRules::canPawnCapture(color_, Square::fromPosition(position_).index(),
+                                          Square::fromPosition(target).index());
     }
     
     /**
@@ -122,7 +61,6 @@ class Pawn : public Piece {
             return false;
         }
         
-        int direction = (color_ == Color::WHITE) ? 1 : -1;
         Position expectedEnemyPos(target.getX(), position_.getY());
         
         return expectedEnemyPos == enPassantTarget;
@@ -3,13 +3,17 @@
 
 #include "../Enums/Color.hpp"
 #include "../Enums/PieceType.hpp"
+#include "../Core/PieceCode.hpp"
 #include "../Utils/Position.hpp"
+#include "../Utils/Square.hpp"
 #include "../Utils/Move.hpp"
 #include <memory>
 
 /**
  * Classe abstraite représentant une pièce d'échecs
  * Respecte le principe d'encapsulation et fournit une interface commune
+ * Adaptateur pour l'interface : les règles viennent des tables de PieceRules,
+ * le moteur travaille directement sur des PieceCode.
  */
 class Piece {
 protected:
@@ -35,6 +39,7 @@ public:
     Color getColor() const { return color_; }
     PieceType getType() const { return type_; }
     bool hasMovedBefore() const { return hasMoved_; }
+    PieceCode getCode() const { return PieceCode(color_, type_); }
     
     /**
      * Met à jour la position de la pièce
@@ -44,16 +49,28 @@ public:
         hasMoved_ = true;
     }
     
+    /**
+     * Force l'indicateur de déplacement (utilisé quand le plateau reconstruit la pièce)
+     */
+    void setMoved(bool moved) {
+        hasMoved_ = moved;
+    }
+    
     /**
      * Vérifie si la pièce peut se déplacer vers une position donnée
-     * Méthode virtuelle pure - doit être implémentée par chaque pièce
+     * Motif de déplacement seulement (ni obstacles ni échec)
      */
-    virtual bool canMoveTo(const Position& target) const = 0;
+    virtual bool canMoveTo(const Position& target) const {
+        return PieceRules::canMove(getCode(), Square::fromPosition(position_).index(),
+                                   Square::fromPosition(target).index());
+    }
     
     /**
      * Retourne la valeur de la pièce pour le calcul du score
      */
-    virtual int getValue() const = 0;
+    virtual int getValue() const {
+        return PieceRules::value(type_);
+    }
     
     /**
      * Méthodes utilitaires pour les couleurs
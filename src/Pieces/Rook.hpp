@@ -2,15 +2,14 @@
 #define ROOK_HPP
 
 #include "Piece.hpp"
-#include "StraightLineMovement.hpp"
 #include "../Utils/Constants.hpp"
 #include <memory>
 
 /**
  * Classe représentant une tour
- * Hérite de Piece et implémente StraightLineMovement
+ * Ses règles de déplacement viennent de PieceRules (voir Piece::canMoveTo)
  */
-class Rook : public Piece, public StraightLineMovement {
+class Rook : public Piece {
 public:
     /**
      * Constructeur
@@ -18,20 +17,6 @@ public:
     Rook(const Position& position, Color color) 
         : Piece(position, color, PieceType::ROOK) {}
     
-    /**
-     * Implémente les règles de mouvement de la tour
-     */
-    bool canMoveTo(const Position& target) const override {
-        return canMoveStraight(position_, target);
-    }
-    
-    /**
-     * Retourne la valeur de la tour
-     */
-    int getValue() const override {
-        return ChessConstants::PieceValues::ROOK;
-    }
-    
     /**
      * Clone la tour
      */
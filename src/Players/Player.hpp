@@ -2,8 +2,9 @@
 #define PLAYER_HPP
 
 #include "../Enums/Color.hpp"
+#include "../Core/PieceCode.hpp"
 #include "../Pieces/Piece.hpp"
-#include <vector>
+#include <array>
 #include <memory>
 
 /**
@@ -12,14 +13,19 @@
  */
 class Player {
 private:
+    // Au plus 15 prises : l'adversaire n'a que 15 pièces hors roi (une promotion remplace un pion)
+    static constexpr size_t MAX_CAPTURES = 16;
+    
     Color color_;
-    std::vector<std::unique_ptr<Piece>> capturedPieces_;
+    std::array<PieceCode, MAX_CAPTURES> capturedPieces_;
+    size_t capturedCount_;
+    int score_;   // Somme des valeurs des pièces prises, tenue à jour à chaque prise
     
 public:
     /**
      * Constructeur
      */
-    explicit Player(Color color) : color_(color) {}
+    explicit Player(Color color) : color_(color), capturedCount_(0), score_(0) {}
     
     /**
      * Destructeur - les smart pointers gèrent automatiquement la mémoire
@@ -37,33 +43,58 @@ public:
     /**
      * Ajoute une pièce capturée
      */
+    void addCapturedPiece(PieceCode piece) {
+        if (capturedCount_ < MAX_CAPTURES) {
+            capturedPieces_[capturedCount_++] = piece;
+            score_ += PieceRules::value(piece.getType());
+        }
+    }
+    
+    /**
+     * Ajoute une pièce capturée (seuls son type et sa couleur sont conservés)
+     */
     void addCapturedPiece(std::unique_ptr<Piece> piece) {
-        capturedPieces_.push_back(std::move(piece));
+        if (piece) {
+            addCapturedPiece(piece->getCode());
+        }
     }
     
     /**
-     * Calcule le score basé sur les pièces capturées
+     * Retire la dernière pièce capturée (annulation d'un coup)
      */
-    int getScore() const {
-        int score = 0;
-        for (const auto& piece : capturedPieces_) {
-            score += piece->getValue();
+    void removeLastCapturedPiece() {
+        if (capturedCount_ > 0) {
+            score_ -= PieceRules::value(capturedPieces_[--capturedCount_].getType());
         }
-        return score;
+    }
+    
+    /**
+     * Score basé sur les pièces capturées (lecture du compteur, sans parcours)
+     */
+    int getScore() const {
+        return score_;
     }
     
     /**
      * Retourne le nombre de pièces capturées
      */
     size_t getCapturedPiecesCount() const {
-        return capturedPieces_.size();
+        return capturedCount_;
+    }
+    
+    /**
+     * Retourne une pièce capturée (dans l'ordre des prises)
+     */
+    PieceCode getCapturedPiece(size_t index) const {
+        return capturedPieces_[index];
     }
     
     /**
      * Vide la liste des pièces capturées
      */
     void clearCapturedPieces() {
-        capturedPieces_.clear();
+        capturedCount_ = 0;
+        score_ = 0;
     }
     
     /**
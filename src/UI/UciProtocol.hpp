@@ -0,0 +1,250 @@
+#ifndef UCI_PROTOCOL_HPP
+#define UCI_PROTOCOL_HPP
+
+#include "../Core/BoardState.hpp"
+#include "../Core/Fen.hpp"
+#include "../Core/Notation.hpp"
+#include "../Engine/Engine.hpp"
+#include "../Engine/Search.hpp"
+#include "../Engine/SearchLimits.hpp"
+#include "../Utils/EngineMove.hpp"
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Dialogue avec une interface graphique selon le protocole UCI
+ *
+ * Les commandes sont lues sur l'entrée standard par le thread appelant ;
+ * la recherche tourne dans le thread du moteur, ce qui permet de traiter
+ * "stop" et "isready" pendant qu'elle réfléchit. Les deux threads écrivent
+ * sur la sortie standard sous le même verrou, une ligne à la fois.
+ */
+class UciProtocol {
+private:
+    Engine engine_;
+    std::istream& input_;
+    std::ostream& output_;
+    std::mutex outputMutex_;
+
+public:
+    UciProtocol(std::istream& input = std::cin, std::ostream& output = std::cout)
+        : input_(input), output_(output) {}
+
+    /**
+     * Traite les commandes jusqu'à "quit" ou la fin de l'entrée
+     */
+    void run() {
+        std::string line;
+        while (std::getline(input_, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (!execute(line)) {
+                break;
+            }
+        }
+        engine_.stop();
+    }
+
+    /**
+     * Exécute une commande
+     * @return false pour "quit"
+     */
+    bool execute(const std::string& line) {
+        std::istringstream stream(line);
+        std::string command;
+        stream >> command;
+
+        if (command == "uci") {
+            sendIdentification();
+        } else if (command == "isready") {
+            send("readyok");
+        } else if (command == "ucinewgame") {
+            engine_.newGame();
+        } else if (command == "setoption") {
+            setOption(stream);
+        } else if (command == "position") {
+            setPosition(stream);
+        } else if (command == "go") {
+            go(stream);
+        } else if (command == "stop") {
+            engine_.stop();
+        } else if (command == "quit") {
+            return false;
+        } else if (!command.empty()) {
+            send("info string commande inconnue : " + command);
+        }
+        return true;
+    }
+
+private:
+    void send(const std::string& line) {
+        std::lock_guard<std::mutex> lock(outputMutex_);
+        output_ << line << std::endl;
+    }
+
+    void sendIdentification() {
+        send("id name Chess");
+        send("id author Chess developers");
+        for (const EngineOption& option : engine_.getOptions()) {
+            std::string line = "option name " + option.name + " type ";
+            switch (option.type) {
+                case EngineOption::Type::SPIN:
+                    line += "spin default " + option.defaultValue + " min " + std::to_string(option.min) +
+                            " max " + std::to_string(option.max);
+                    break;
+                case EngineOption::Type::CHECK:
+                    line += "check default " + option.defaultValue;
+                    break;
+                case EngineOption::Type::BUTTON:
+                    line += "button";
+                    break;
+                case EngineOption::Type::STRING:
+                    line += "string default " + (option.defaultValue.empty() ? "<empty>" : option.defaultValue);
+                    break;
+            }
+            send(line);
+        }
+        send("uciok");
+    }
+
+    /**
+     * setoption name <nom> [value <valeur>] (le nom et la valeur peuvent contenir des espaces)
+     */
+    void setOption(std::istringstream& stream) {
+        std::string word;
+        std::string name;
+        std::string value;
+        std::string* target = nullptr;
+
+        while (stream >> word) {
+            if (word == "name") {
+                target = &name;
+            } else if (word == "value") {
+                target = &value;
+            } else if (target) {
+                if (!target->empty()) {
+                    *target += ' ';
+                }
+                *target += word;
+            }
+        }
+
+        const char* error = engine_.setOption(name, value);
+        if (error) {
+            send("info string " + std::string(error) + " : " + name);
+        }
+    }
+
+    /**
+     * position startpos|fen <FEN> [moves <coup>...]
+     */
+    void setPosition(std::istringstream& stream) {
+        std::string word;
+        stream >> word;
+
+        BoardState start;
+        if (word == "startpos") {
+            start = BoardState::startingPosition();
+            stream >> word;
+        } else if (word == "fen") {
+            std::string fen;
+            while (stream >> word && word != "moves") {
+                fen += fen.empty() ? word : " " + word;
+            }
+            const char* error = Fen::read(fen, start);
+            if (error) {
+                send("info string FEN invalide : " + std::string(error));
+                return;
+            }
+        } else {
+            send("info string position attendue : startpos ou fen");
+            return;
+        }
+
+        // Les coups sont décodés sur une copie : la position n'est changée que s'ils sont tous légaux
+        std::vector<EngineMove> moves;
+        if (word == "moves") {
+            BoardState current = start;
+            UndoInfo undo;
+            while (stream >> word) {
+                EngineMove move;
+                const char* error = Notation::readUci(current, word, move);
+                if (error) {
+                    send("info string " + std::string(error) + " : " + word);
+                    return;
+                }
+                current.makeMove(move, undo);
+                moves.push_back(move);
+            }
+        }
+        engine_.setPosition(start, moves);
+    }
+
+    /**
+     * go [depth N] [nodes N] [movetime ms] [wtime ms] [btime ms] [winc ms] [binc ms] [movestogo N] [infinite]
+     */
+    void go(std::istringstream& stream) {
+        SearchLimits limits;
+        std::string word;
+        while (stream >> word) {
+            if (word == "depth") {
+                stream >> limits.depth;
+            } else if (word == "nodes") {
+                stream >> limits.nodes;
+            } else if (word == "movetime") {
+                stream >> limits.moveTime;
+            } else if (word == "wtime") {
+                stream >> limits.time[static_cast<int>(Color::WHITE)];
+            } else if (word == "btime") {
+                stream >> limits.time[static_cast<int>(Color::BLACK)];
+            } else if (word == "winc") {
+                stream >> limits.increment[static_cast<int>(Color::WHITE)];
+            } else if (word == "binc") {
+                stream >> limits.increment[static_cast<int>(Color::BLACK)];
+            } else if (word == "movestogo") {
+                stream >> limits.movesToGo;
+            } else if (word == "infinite") {
+                limits.infinite = true;
+            }
+        }
+
+        engine_.go(limits,
+                   [this](const SearchReport& report) { send(formatInfo(report)); },
+                   [this](const EngineMove& move) { send("bestmove " + Notation::toUci(move)); });
+    }
+
+    static std::string formatInfo(const SearchReport& report) {
+        std::string line = "info depth " + std::to_string(report.depth) + " score " + formatScore(report.score) +
+                           " nodes " + std::to_string(report.nodes) + " hashfull " + std::to_string(report.hashfull) +
+                           " nps " + std::to_string(static_cast<std::uint64_t>(report.nodesPerSecond())) +
+                           " time " + std::to_string(static_cast<std::uint64_t>(report.seconds * 1000.0));
+        if (!report.pv.empty()) {
+            line += " pv";
+            for (const EngineMove& move : report.pv) {
+                line += ' ';
+                line += Notation::toUci(move);
+            }
+        }
+        return line;
+    }
+
+    /**
+     * "cp <centipions>" ou "mate <coups>" (négatif quand le camp au trait est maté)
+     */
+    static std::string formatScore(int score) {
+        if (score >= Search::MATE_BOUND) {
+            return "mate " + std::to_string((Search::MATE_SCORE - score + 1) / 2);
+        }
+        if (score <= -Search::MATE_BOUND) {
+            return "mate " + std::to_string(-(Search::MATE_SCORE + score) / 2);
+        }
+        return "cp " + std::to_string(score);
+    }
+};
+
+#endif // UCI_PROTOCOL_HPP
\ No newline at end of file
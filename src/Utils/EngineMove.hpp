@@ -0,0 +1,147 @@
+#ifndef ENGINE_MOVE_HPP
+#define ENGINE_MOVE_HPP
+
+#include "Move.hpp"
+#include "Position.hpp"
+#include "Square.hpp"
+#include "../Core/Bitboard.hpp"
+#include "../Enums/PieceType.hpp"
+#include <cstdint>
+#include <string>
+
+/**
+ * Mouvement compact utilisé par le moteur (génération, recherche)
+ * Contrairement à Move, il connaît la promotion et les coups spéciaux.
+ * Le roque est codé comme le déplacement du roi (e1 -> g1).
+ *
+ * Tient sur 16 bits : départ (bits 0-5), arrivée (6-11),
+ * pièce de promotion (12-13) et type de coup (14-15).
+ */
+class EngineMove {
+public:
+    enum class Kind : std::uint8_t {
+        NORMAL,
+        PROMOTION,
+        EN_PASSANT,
+        CASTLING
+    };
+
+private:
+    static constexpr int TO_SHIFT = 6;
+    static constexpr int PROMOTION_SHIFT = 12;
+    static constexpr int KIND_SHIFT = 14;
+    static constexpr std::uint16_t SQUARE_MASK = 0x3F;
+
+    std::uint16_t data_;
+
+    // Code de promotion sur 2 bits : 0 = dame, pour que les coups non promus aient la dame par défaut
+    static constexpr std::uint16_t promotionCode(PieceType type) {
+        return type == PieceType::KNIGHT ? 1 : type == PieceType::ROOK ? 2 : type == PieceType::BISHOP ? 3 : 0;
+    }
+
+    static constexpr PieceType promotionType(int code) {
+        return code == 1 ? PieceType::KNIGHT : code == 2 ? PieceType::ROOK : code == 3 ? PieceType::BISHOP
+                                                                                        : PieceType::QUEEN;
+    }
+
+public:
+    /**
+     * Constructeur par défaut non initialisé : les MoveList n'ont rien à remplir
+     */
+    EngineMove() = default;
+
+    constexpr EngineMove(int from, int to, Kind kind = Kind::NORMAL, PieceType promotion = PieceType::QUEEN)
+        : data_(static_cast<std::uint16_t>(
+              from | (to << TO_SHIFT) |
+              ((kind == Kind::PROMOTION ? promotionCode(promotion) : 0) << PROMOTION_SHIFT) |
+              (static_cast<int>(kind) << KIND_SHIFT))) {}
+
+    constexpr EngineMove(Square from, Square to, Kind kind = Kind::NORMAL, PieceType promotion = PieceType::QUEEN)
+        : EngineMove(from.index(), to.index(), kind, promotion) {}
+
+    /**
+     * Mouvement nul (aucun coup)
+     */
+    static constexpr EngineMove none() {
+        return EngineMove(0, 0);
+    }
+
+    /**
+     * Reconstruit un coup depuis sa forme compacte (table de transposition, fichiers)
+     */
+    static constexpr EngineMove fromRaw(std::uint16_t raw) {
+        EngineMove move(0, 0);
+        move.data_ = raw;
+        return move;
+    }
+
+    /**
+     * Conversion depuis le Move de l'interface
+     * Le type de coup n'est pas connu : le coup produit est NORMAL, ou une promotion
+     * si promotion est fournie. Le coup légal correspondant se retrouve avec isSameSquares().
+     */
+    static EngineMove fromMove(const Move& move) noexcept {
+        return EngineMove(Square::fromPosition(move.getFrom()), Square::fromPosition(move.getTo()));
+    }
+
+    static EngineMove fromMove(const Move& move, PieceType promotion) noexcept {
+        return EngineMove(Square::fromPosition(move.getFrom()), Square::fromPosition(move.getTo()),
+                          Kind::PROMOTION, promotion);
+    }
+
+    // Getters
+    constexpr int getFrom() const { return data_ & SQUARE_MASK; }
+    constexpr int getTo() const { return (data_ >> TO_SHIFT) & SQUARE_MASK; }
+    constexpr Square getFromSquare() const { return Square(getFrom()); }
+    constexpr Square getToSquare() const { return Square(getTo()); }
+    constexpr Kind getKind() const { return static_cast<Kind>(data_ >> KIND_SHIFT); }
+    constexpr PieceType getPromotion() const { return promotionType((data_ >> PROMOTION_SHIFT) & 3); }
+    constexpr std::uint16_t getRaw() const { return data_; }
+
+    constexpr bool isNone() const { return getFrom() == getTo(); }
+    constexpr bool isPromotion() const { return getKind() == Kind::PROMOTION; }
+    constexpr bool isEnPassant() const { return getKind() == Kind::EN_PASSANT; }
+    constexpr bool isCastling() const { return getKind() == Kind::CASTLING; }
+
+    /**
+     * Même départ et même arrivée, quel que soit le type de coup
+     */
+    constexpr bool isSameSquares(const EngineMove& other) const {
+        return ((data_ ^ other.data_) & ((SQUARE_MASK << TO_SHIFT) | SQUARE_MASK)) == 0;
+    }
+
+    constexpr bool operator==(const EngineMove& other) const {
+        return data_ == other.data_;
+    }
+
+    constexpr bool operator!=(const EngineMove& other) const {
+        return data_ != other.data_;
+    }
+
+    /**
+     * Notation en coordonnées (ex: "e2e4", "e7e8q")
+     */
+    std::string toString() const {
+        std::string text = getFromSquare().toString() + getToSquare().toString();
+        if (isPromotion()) {
+            switch (getPromotion()) {
+                case PieceType::KNIGHT: text += 'n'; break;
+                case PieceType::BISHOP: text += 'b'; break;
+                case PieceType::ROOK:   text += 'r'; break;
+                default:                text += 'q'; break;
+            }
+        }
+        return text;
+    }
+    
+    /**
+     * Conversion vers le Move de l'interface (la promotion est perdue)
+     */
+    Move toMove() const {
+        return Move(getFromSquare().toPosition(), getToSquare().toPosition());
+    }
+};
+
+static_assert(sizeof(EngineMove) == 2, "EngineMove doit tenir sur 16 bits");
+
+#endif // ENGINE_MOVE_HPP
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef MOVE_LIST_HPP
+#define MOVE_LIST_HPP
+
+#include "EngineMove.hpp"
+#include <array>
+
+/**
+ * Liste de mouvements à capacité fixe, allouée sur la pile
+ * 256 places suffisent : aucune position légale ne dépasse 218 coups.
+ */
+class MoveList {
+public:
+    static constexpr int MAX_MOVES = 256;
+
+private:
+    std::array<EngineMove, MAX_MOVES> moves_;
+    int size_;
+
+public:
+    MoveList() : size_(0) {}
+
+    void add(const EngineMove& move) {
+        moves_[size_++] = move;
+    }
+
+    void clear() {
+        size_ = 0;
+    }
+
+    /**
+     * Tronque la liste aux 'size' premiers mouvements
+     */
+    void resize(int size) {
+        size_ = size;
+    }
+
+    int size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    EngineMove& operator[](int index) { return moves_[index]; }
+    const EngineMove& operator[](int index) const { return moves_[index]; }
+
+    EngineMove* begin() { return moves_.data(); }
+    EngineMove* end() { return moves_.data() + size_; }
+    const EngineMove* begin() const { return moves_.data(); }
+    const EngineMove* end() const { return moves_.data() + size_; }
+
+    bool contains(const EngineMove& move) const {
+        for (const EngineMove& candidate : *this) {
+            if (candidate == move) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+#endif // MOVE_LIST_HPP
\ No newline at end of file
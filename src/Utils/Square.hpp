@@ -0,0 +1,92 @@
+#ifndef SQUARE_HPP
+#define SQUARE_HPP
+
+#include "Position.hpp"
+#include "../Core/Bitboard.hpp"
+#include <cstdint>
+#include <string>
+
+/**
+ * Case de l'échiquier sous forme d'index 0..63 (a1 = 0, h8 = 63)
+ * Équivalent de Position pour les chemins critiques : un octet, constexpr,
+ * et aucune exception. Une coordonnée hors plateau donne la case invalide
+ * (Square::none()) au lieu de lever std::invalid_argument.
+ */
+class Square {
+private:
+    static constexpr std::uint8_t NONE = Bitboards::SQUARE_COUNT;
+
+    std::uint8_t index_;
+
+public:
+    /**
+     * Constructeur par défaut : case invalide
+     */
+    constexpr Square() noexcept : index_(NONE) {}
+
+    /**
+     * Constructeur depuis un index (non vérifié, l'appelant garantit 0..63)
+     */
+    constexpr explicit Square(int index) noexcept : index_(static_cast<std::uint8_t>(index)) {}
+
+    static constexpr Square none() noexcept {
+        return Square();
+    }
+
+    /**
+     * Case (x, y), ou case invalide si les coordonnées sortent du plateau
+     */
+    static constexpr Square fromCoordinates(int x, int y) noexcept {
+        return isOnBoard(x, y) ? Square(Bitboards::squareIndex(x, y)) : none();
+    }
+
+    static Square fromPosition(const Position& position) noexcept {
+        return Square(Bitboards::squareIndex(position.getX(), position.getY()));
+    }
+
+    // Getters
+    constexpr int index() const noexcept { return index_; }
+    constexpr int getX() const noexcept { return Bitboards::fileOf(index_); }
+    constexpr int getY() const noexcept { return Bitboards::rankOf(index_); }
+    constexpr Bitboard bitboard() const noexcept { return Bitboards::squareBB(index_); }
+
+    constexpr bool isValid() const noexcept { return index_ < NONE; }
+
+    /**
+     * Case décalée de (dx, dy), ou case invalide si elle sort du plateau
+     */
+    constexpr Square offset(int dx, int dy) const noexcept {
+        return isValid() ? fromCoordinates(getX() + dx, getY() + dy) : none();
+    }
+
+    constexpr bool operator==(const Square& other) const noexcept { return index_ == other.index_; }
+    constexpr bool operator!=(const Square& other) const noexcept { return index_ != other.index_; }
+
+    /**
+     * Conversion vers la Position de l'interface (la case doit être valide)
+     */
+    Position toPosition() const {
+        return Position(getX(), getY());
+    }
+
+    /**
+     * Notation algébrique (ex: "e4"), "-" pour la case invalide
+     */
+    std::string toString() const {
+        if (!isValid()) {
+            return "-";
+        }
+        std::string text;
+        text += static_cast<char>('a' + getX());
+        text += static_cast<char>('1' + getY());
+        return text;
+    }
+
+private:
+    static constexpr bool isOnBoard(int x, int y) noexcept {
+        return x >= ChessConstants::MIN_COORDINATE && x <= ChessConstants::MAX_COORDINATE &&
+               y >= ChessConstants::MIN_COORDINATE && y <= ChessConstants::MAX_COORDINATE;
+    }
+};
+
+#endif // SQUARE_HPP
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * Groupe de threads de travail persistants
+ * Les tâches sont prises dans une file commune ; wait() bloque jusqu'à ce qu'elles soient toutes finies.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable taskAvailable_;
+    std::condition_variable allDone_;
+    size_t pending_;
+    bool stopping_;
+
+public:
+    /**
+     * Constructeur
+     * @param threadCount Nombre de threads (0 = nombre de cœurs disponibles)
+     */
+    explicit ThreadPool(size_t threadCount = 0) : pending_(0), stopping_(false) {
+        if (threadCount == 0) {
+            threadCount = defaultThreadCount();
+        }
+        workers_.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i) {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        taskAvailable_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Ajoute une tâche à la file
+     */
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+            ++pending_;
+        }
+        taskAvailable_.notify_one();
+    }
+
+    /**
+     * Attend la fin de toutes les tâches soumises
+     */
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        allDone_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+    size_t size() const {
+        return workers_.size();
+    }
+
+    static size_t defaultThreadCount() {
+        unsigned int cores = std::thread::hardware_concurrency();
+        return cores == 0 ? 1 : cores;
+    }
+
+private:
+    void workerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                taskAvailable_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (stopping_ && tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+
+            task();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                allDone_.notify_all();
+            }
+        }
+    }
+};
+
+#endif // THREAD_POOL_HPP
\ No newline at end of file